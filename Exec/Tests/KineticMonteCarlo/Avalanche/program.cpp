@@ -84,6 +84,11 @@ main(int argc, char* argv[])
 
       kmcSolver.stepSSA(state);
     }
+    else if (alg == "nrm") {
+      nextDt = stopTime / numSteps;
+
+      kmcSolver.advanceNRM(state, nextDt);
+    }
     else if (alg == "tau") {
       nextDt = stopTime / numSteps;
 
@@ -95,7 +100,7 @@ main(int argc, char* argv[])
       kmcSolver.advanceHybrid(state, nextDt);
     }
     else {
-      const std::string err = "Expected algorithm to be 'ssa', 'tau', or 'hybrid' but got '" + alg + "'";
+      const std::string err = "Expected algorithm to be 'ssa', 'nrm', 'tau', or 'hybrid' but got '" + alg + "'";
 
       MayDay::Error(err.c_str());
     }
@@ -0,0 +1,121 @@
+#include <CD_Driver.H>
+#include <CD_KMCSolver.H>
+#include <CD_KMCSingleStateReaction.H>
+#include <CD_Timer.H>
+
+// TLDR: This program benchmarks the exact SSA methods in KMCSolver for conversion networks
+//
+//       X_i -> X_j (rate k_i)
+//
+//       with M species and M reactions. The rates are log-uniformly distributed between min_rate and max_rate.
+
+using namespace ChomboDischarge;
+
+using FPR      = long long;
+using KMCState = KMCSingleState<FPR>;
+
+// Reaction type which counts the number of times that reactions fire.
+class KMCReaction : public KMCSingleStateReaction<KMCState, FPR>
+{
+public:
+  using KMCSingleStateReaction<KMCState, FPR>::KMCSingleStateReaction;
+
+  inline void
+  advanceState(KMCState& a_state, const FPR& a_numReactions) const noexcept
+  {
+    s_numEvents += a_numReactions;
+
+    KMCSingleStateReaction<KMCState, FPR>::advanceState(a_state, a_numReactions);
+  }
+
+  static long long s_numEvents;
+};
+
+long long KMCReaction::s_numEvents = 0LL;
+
+using KMCSolverType = KMCSolver<KMCReaction, KMCState, FPR>;
+
+int
+main(int argc, char* argv[])
+{
+#ifdef CH_MPI
+  MPI_Init(&argc, &argv);
+#endif
+
+  // Read input file.
+  ParmParse pp(argc - 2, argv + 2, NULL, argv[1]);
+
+  // Seed the RNG
+  Random::setSeed(0);
+
+  Real stopTime = 0.0;
+  Real minRate  = 0.0;
+  Real maxRate  = 0.0;
+  int  initVal  = 0;
+
+  Vector<int> numReactions(pp.countval("num_reactions"));
+
+  pp.get("stop_time", stopTime);
+  pp.get("min_rate", minRate);
+  pp.get("max_rate", maxRate);
+  pp.get("initial_particles", initVal);
+  pp.getarr("num_reactions", numReactions, 0, numReactions.size());
+
+  const std::vector<std::string> algorithms{"ssa", "nrm", "cr"};
+
+  pout() << "# Number of reactions"
+         << "\t"
+         << "Algorithm"
+         << "\t"
+         << "Number of events"
+         << "\t"
+         << "Events per second" << endl;
+
+  for (const auto& M : numReactions) {
+
+    // Define the reaction network X_i -> X_j with j != i.
+    std::vector<std::shared_ptr<const KMCReaction>> reactionList;
+
+    for (int i = 0; i < M; i++) {
+      const size_t j = (i + 1 + (size_t)(Random::getUniformReal01() * (M - 1))) % M;
+
+      auto reaction = std::make_shared<KMCReaction>(std::list<size_t>{(size_t)i}, std::list<size_t>{j});
+
+      reaction->rate() = minRate * std::pow(maxRate / minRate, Random::getUniformReal01());
+
+      reactionList.emplace_back(reaction);
+    }
+
+    KMCSolverType kmcSolver(reactionList);
+
+    for (const auto& alg : algorithms) {
+      KMCState state(M);
+      for (int i = 0; i < M; i++) {
+        state[i] = (FPR)initVal;
+      }
+
+      KMCReaction::s_numEvents = 0LL;
+
+      const Real t0 = Timer::wallClock();
+
+      if (alg == "ssa") {
+        kmcSolver.advanceSSA(state, stopTime);
+      }
+      else if (alg == "nrm") {
+        kmcSolver.advanceNRM(state, stopTime);
+      }
+      else if (alg == "cr") {
+        kmcSolver.advanceCR(state, stopTime);
+      }
+
+      const Real t1 = Timer::wallClock();
+
+      pout() << M << "\t" << alg << "\t" << KMCReaction::s_numEvents << "\t"
+             << KMCReaction::s_numEvents / std::max(t1 - t0, std::numeric_limits<Real>::min()) << endl;
+    }
+  }
+
+#ifdef CH_MPI
+  MPI_Finalize();
+#endif
+}
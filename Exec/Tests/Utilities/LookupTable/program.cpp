@@ -44,6 +44,113 @@ main(int argc, char* argv[])
 
   const auto interpRow = slicedTable.interpolate(std::numeric_limits<Real>::max());
 
+  // Two-dimensional tables. The data is bilinear in (x,y) so that multilinear interpolation reproduces it exactly, also on logarithmic axes
+  // and when extrapolating with the 'Interpolate' strategy.
+  auto f = [](const Real x, const Real y) -> Real {
+    return 1.0 + 2.0 * x + 3.0E-3 * y + 0.5E-3 * x * y;
+  };
+
+  auto checkValue = [](const Real a_value, const Real a_exact, const std::string a_what) -> void {
+    if (std::abs(a_value - a_exact) > 1.E-10 * std::max(1.0, std::abs(a_exact))) {
+      const std::string err = "LookupTable/program.cpp - " + a_what + " failed, got " + std::to_string(a_value) + " but expected " +
+                              std::to_string(a_exact);
+
+      MayDay::Error(err.c_str());
+    }
+  };
+
+  const std::vector<Real> xCoords = {1.0, 2.0, 4.0, 7.0};
+  const std::vector<Real> yCoords = {300.0, 450.0, 600.0};
+
+  const std::vector<Real> xProbes = {1.0, 1.3, 2.5, 4.0, 6.9, 7.0};
+  const std::vector<Real> yProbes = {300.0, 333.3, 500.0, 600.0};
+
+  const std::array<LookupTable::Spacing, 2> uniform     = {LookupTable::Spacing::Uniform, LookupTable::Spacing::Uniform};
+  const std::array<LookupTable::Spacing, 2> exponential = {LookupTable::Spacing::Exponential, LookupTable::Spacing::Uniform};
+
+  for (const auto& spacing : {uniform, exponential}) {
+    LookupTable2D<Real, 1> table2D;
+
+    // Add the rows in reverse order -- the table should not care.
+    for (auto y = yCoords.rbegin(); y != yCoords.rend(); ++y) {
+      for (auto x = xCoords.rbegin(); x != xCoords.rend(); ++x) {
+        table2D.addData(*x, *y, f(*x, *y));
+      }
+    }
+
+    table2D.prepareTable({(size_t)numPoints, 17}, spacing);
+
+    // Inside the table.
+    for (const auto& x : xProbes) {
+      for (const auto& y : yProbes) {
+        checkValue(table2D.interpolate<2>({x, y}), f(x, y), "LookupTable2D::interpolate<2>");
+        checkValue(table2D.interpolate({x, y})[2], f(x, y), "LookupTable2D::interpolate");
+      }
+    }
+
+    // Out of range with the default (constant) strategy.
+    checkValue(table2D.interpolate<2>({0.5, 500.0}), f(1.0, 500.0), "LookupTable2D constant out-of-range (x lo)");
+    checkValue(table2D.interpolate<2>({9.0, 500.0}), f(7.0, 500.0), "LookupTable2D constant out-of-range (x hi)");
+    checkValue(table2D.interpolate<2>({2.5, 100.0}), f(2.5, 300.0), "LookupTable2D constant out-of-range (y lo)");
+    checkValue(table2D.interpolate<2>({9.0, 900.0}), f(7.0, 600.0), "LookupTable2D constant out-of-range (x hi, y hi)");
+
+    // Out of range with linear extrapolation.
+    table2D.setRangeStrategyLo(0, LookupTable::OutOfRangeStrategy::Interpolate);
+    table2D.setRangeStrategyHi(0, LookupTable::OutOfRangeStrategy::Interpolate);
+    table2D.setRangeStrategyHi(1, LookupTable::OutOfRangeStrategy::Interpolate);
+
+    checkValue(table2D.interpolate<2>({0.5, 500.0}), f(0.5, 500.0), "LookupTable2D interpolated out-of-range (x lo)");
+    checkValue(table2D.interpolate<2>({9.0, 500.0}), f(9.0, 500.0), "LookupTable2D interpolated out-of-range (x hi)");
+    checkValue(table2D.interpolate<2>({9.0, 900.0}), f(9.0, 900.0), "LookupTable2D interpolated out-of-range (x hi, y hi)");
+    checkValue(table2D.interpolate<2>({2.5, 100.0}), f(2.5, 300.0), "LookupTable2D constant out-of-range (y lo)");
+
+    // Batched interpolation must give the same result as the scalar version.
+    std::vector<Real> xBatch;
+    std::vector<Real> yBatch;
+
+    for (const auto& x : xProbes) {
+      for (const auto& y : yProbes) {
+        xBatch.emplace_back(x);
+        yBatch.emplace_back(y);
+      }
+    }
+    xBatch.emplace_back(0.5);
+    yBatch.emplace_back(900.0);
+
+    std::vector<Real> batch(xBatch.size());
+
+    table2D.interpolate<2>(batch.data(), {xBatch.data(), yBatch.data()}, batch.size());
+
+    for (size_t i = 0; i < batch.size(); i++) {
+      checkValue(batch[i], table2D.interpolate<2>({xBatch[i], yBatch[i]}), "LookupTable2D batched interpolate<2>");
+    }
+  }
+
+  // Raw data that is not on a tensor-product grid must be rejected.
+  LookupTable2D<Real, 1> nonTensorTable;
+
+  for (const auto& x : xCoords) {
+    for (const auto& y : yCoords) {
+      if (!(x == 4.0 && y == 450.0)) {
+        nonTensorTable.addData(x, y, f(x, y));
+      }
+    }
+  }
+  nonTensorTable.addData(3.0, 450.0, f(3.0, 450.0));
+
+  bool didThrow = false;
+
+  try {
+    nonTensorTable.prepareTable({10, 10}, uniform);
+  }
+  catch (const std::runtime_error&) {
+    didThrow = true;
+  }
+
+  if (!didThrow) {
+    MayDay::Error("LookupTable/program.cpp - LookupTable2D::prepareTable should throw for data that is not on a tensor-product grid");
+  }
+
 #ifdef CH_MPI
   CH_TIMER_REPORT();
   MPI_Finalize();
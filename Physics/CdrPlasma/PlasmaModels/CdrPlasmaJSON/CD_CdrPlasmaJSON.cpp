@@ -16,6 +16,8 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <cmath>
+#include <functional>
 
 // Chombo includes
 #include <ParmParse.H>
@@ -31,6 +33,8 @@
 
 using namespace Physics::CdrPlasma;
 
+thread_local CdrPlasmaJSON::ChemistryWorkspace CdrPlasmaJSON::s_chemistryWorkspace;
+
 CdrPlasmaJSON::CdrPlasmaJSON()
 {
   CH_TIME("CdrPlasmaJSON::CdrPlasmaJSON()");
@@ -61,6 +65,9 @@ CdrPlasmaJSON::CdrPlasmaJSON()
   this->parsePlasmaReactions();
   this->parsePhotoReactions();
 
+  // Flatten the plasma reaction network so that we can evaluate the rates without going through the maps.
+  this->compilePlasmaReactions();
+
   // Parse secondary emission on electrodes and dielectrics
   this->parseElectrodeReactions();
   this->parseDielectricReactions();
@@ -110,6 +117,17 @@ CdrPlasmaJSON::parseIntegrator()
   pp.get("integrator", str);
   pp.get("chemistry_dt", m_chemistryDt);
 
+  // Tolerances for the adaptive integrator. These are optional.
+  m_chemistryRelTol = 1.E-3;
+  m_chemistryAbsTol = 1.0;
+
+  pp.query("chemistry_rel_tol", m_chemistryRelTol);
+  pp.query("chemistry_abs_tol", m_chemistryAbsTol);
+
+  if (m_chemistryRelTol <= 0.0 || m_chemistryAbsTol <= 0.0) {
+    this->throwParserError("CdrPlasmaJSON::parseIntegrator -- chemistry tolerances must be > 0");
+  }
+
   if (m_chemistryDt <= 0.0) {
     this->throwParserError("CdrPlasmaJSON::parseIntegrator -- substeps must be >= 1");
   }
@@ -129,6 +147,9 @@ CdrPlasmaJSON::parseIntegrator()
   else if (str == "explicit_rk4") {
     m_reactionIntegrator = ReactionIntegrator::ExplicitRK4;
   }
+  else if (str == "rosenbrock") {
+    m_reactionIntegrator = ReactionIntegrator::Rosenbrock;
+  }
   else {
     this->throwParserError("CdrPlasmaJSON::parseIntegrator -- I do not know the integrator '" + str + "'");
   }
@@ -2357,6 +2378,169 @@ CdrPlasmaJSON::parsePlasmaReactions()
   }
 }
 
+void
+CdrPlasmaJSON::compilePlasmaReactions()
+{
+  CH_TIME("CdrPlasmaJSON::compilePlasmaReactions()");
+  if (m_verbose) {
+    pout() << "CdrPlasmaJSON::compilePlasmaReactions()" << endl;
+  }
+
+  CompiledReactionNetwork& net = m_compiledReactions;
+
+  net = CompiledReactionNetwork();
+
+  net.needsGasTemperature = false;
+
+  net.plasmaReactantOffsets.push_back(0);
+  net.neutralReactantOffsets.push_back(0);
+  net.plasmaProductOffsets.push_back(0);
+  net.photonProductOffsets.push_back(0);
+  net.energyLossOffsets.push_back(0);
+
+  std::vector<bool> isNeutralReactant(m_neutralSpeciesDensities.size(), false);
+
+  for (int i = 0; i < m_plasmaReactions.size(); i++) {
+    const CdrPlasmaReactionJSON& reaction = m_plasmaReactions[i];
+
+    const LookupMethod method = m_plasmaReactionLookup.at(i);
+
+    Real                          constant    = 0.0;
+    std::array<int, 2>            species     = {-1, -1};
+    const LookupTable1D<Real, 1>* table       = nullptr;
+    const LookupTable2D<Real, 1>* table2D     = nullptr;
+    const FunctionEN*             functionEN  = nullptr;
+    const FunctionT*              functionT   = nullptr;
+    const FunctionTT*             functionTT  = nullptr;
+    bool                          useNeutrals = true;
+
+    switch (method) {
+    case LookupMethod::Constant: {
+      constant = m_plasmaReactionConstants.at(i);
+
+      break;
+    }
+    case LookupMethod::FunctionEN: {
+      functionEN = &(m_plasmaReactionFunctionsEN.at(i));
+
+      break;
+    }
+    case LookupMethod::TableEN: {
+      table = &(m_plasmaReactionTablesEN.at(i));
+
+      break;
+    }
+    case LookupMethod::TableEnergy: {
+      species[0] = m_plasmaReactionTablesEnergy.at(i).first;
+      table      = &(m_plasmaReactionTablesEnergy.at(i).second);
+
+      break;
+    }
+    case LookupMethod::TableENT: {
+      species[0] = m_plasmaReactionTablesENT.at(i).first;
+      table2D    = &(m_plasmaReactionTablesENT.at(i).second);
+
+      net.needsGasTemperature = net.needsGasTemperature || (species[0] < 0);
+
+      break;
+    }
+    case LookupMethod::AlphaV: {
+      species[0]  = m_plasmaReactionAlphaV.at(i);
+      useNeutrals = false;
+
+      break;
+    }
+    case LookupMethod::EtaV: {
+      species[0]  = m_plasmaReactionEtaV.at(i);
+      useNeutrals = false;
+
+      break;
+    }
+    case LookupMethod::FunctionT: {
+      species[0] = m_plasmaReactionFunctionsT.at(i).first;
+      functionT  = &(m_plasmaReactionFunctionsT.at(i).second);
+
+      net.needsGasTemperature = net.needsGasTemperature || (species[0] < 0);
+
+      break;
+    }
+    case LookupMethod::FunctionTT: {
+      species[0] = std::get<0>(m_plasmaReactionFunctionsTT.at(i));
+      species[1] = std::get<1>(m_plasmaReactionFunctionsTT.at(i));
+      functionTT = &(std::get<2>(m_plasmaReactionFunctionsTT.at(i)));
+
+      net.needsGasTemperature = net.needsGasTemperature || (species[0] < 0) || (species[1] < 0);
+
+      break;
+    }
+    default: {
+      MayDay::Error("CdrPlasmaJSON::compilePlasmaReactions -- logic bust");
+
+      break;
+    }
+    }
+
+    net.lookup.push_back(method);
+    net.constants.push_back(constant);
+    net.species.push_back(species);
+    net.tables.push_back(table);
+    net.tables2D.push_back(table2D);
+    net.functionsEN.push_back(functionEN);
+    net.functionsT.push_back(functionT);
+    net.functionsTT.push_back(functionTT);
+    net.efficiencies.push_back(&(m_plasmaReactionEfficiencies.at(i)));
+
+    const std::pair<bool, int>& soloviev = m_plasmaReactionSolovievCorrection.at(i);
+
+    net.solovievSpecies.push_back(soloviev.first ? soloviev.second : -1);
+
+    // Stoichiometry.
+    for (const auto& r : reaction.getPlasmaReactants()) {
+      net.plasmaReactants.push_back(r);
+    }
+
+    if (useNeutrals) {
+      for (const auto& n : reaction.getNeutralReactants()) {
+        net.neutralReactants.push_back(n);
+
+        isNeutralReactant[n] = true;
+      }
+    }
+
+    for (const auto& p : reaction.getPlasmaProducts()) {
+      net.plasmaProducts.push_back(p);
+    }
+
+    for (const auto& p : reaction.getPhotonProducts()) {
+      net.photonProducts.push_back(p);
+    }
+
+    // Reactive energy losses.
+    if (m_plasmaReactionHasEnergyLoss.at(i)) {
+      for (const auto& curReactionLoss : m_plasmaReactionEnergyLosses.at(i)) {
+        const int transportIndex = curReactionLoss.first;
+
+        net.energyLossTransport.push_back(transportIndex);
+        net.energyLossEnergy.push_back(m_cdrTransportEnergyMap.at(transportIndex));
+        net.energyLossMethod.push_back((curReactionLoss.second).first);
+        net.energyLossFactor.push_back((curReactionLoss.second).second);
+      }
+    }
+
+    net.plasmaReactantOffsets.push_back(net.plasmaReactants.size());
+    net.neutralReactantOffsets.push_back(net.neutralReactants.size());
+    net.plasmaProductOffsets.push_back(net.plasmaProducts.size());
+    net.photonProductOffsets.push_back(net.photonProducts.size());
+    net.energyLossOffsets.push_back(net.energyLossTransport.size());
+  }
+
+  for (int n = 0; n < isNeutralReactant.size(); n++) {
+    if (isNeutralReactant[n]) {
+      net.neutralSpecies.push_back(n);
+    }
+  }
+}
+
 std::list<std::tuple<std::string, std::vector<std::string>, std::vector<std::string>>>
 CdrPlasmaJSON::parseReactionWildcards(const std::vector<std::string>& a_reactants,
                                       const std::vector<std::string>& a_products,
@@ -2893,6 +3077,112 @@ CdrPlasmaJSON::parsePlasmaReactionRate(const int a_reactionIndex, const json& a_
     m_plasmaReactionLookup.emplace(std::make_pair(a_reactionIndex, LookupMethod::TableEnergy));
     m_plasmaReactionTablesEnergy.emplace(std::make_pair(a_reactionIndex, std::make_pair(speciesIdx, reactionTable)));
   }
+  else if (lookup == "table E/N T") {
+    if (!(a_R.contains("file")))
+      this->throwParserError(baseError + "and got 'table E/N T' but field 'file' was not found");
+    if (!(a_R.contains("header")))
+      this->throwParserError(baseError + "and got 'table E/N T' but field 'header' was not found");
+    if (!(a_R.contains("E/N")))
+      this->throwParserError(baseError + "and got 'table E/N T' but field 'E/N' was not found");
+    if (!(a_R.contains("temperature")))
+      this->throwParserError(baseError + "and got 'table E/N T' but field 'temperature' was not found");
+    if (!(a_R.contains("rate")))
+      this->throwParserError(baseError + "and got 'table E/N T' but field 'rate' was not found");
+    if (!(a_R.contains("T")))
+      this->throwParserError(baseError + "and got 'table E/N T' but field 'T' was not found");
+    if (!(a_R.contains("points")))
+      this->throwParserError(baseError + "and got 'table E/N T' but field 'points' was not found");
+    if (!(a_R.contains("spacing")))
+      this->throwParserError(baseError + "and got 'table E/N T' but field 'spacing' was not found");
+
+    const std::string speciesT  = this->trim(a_R["T"].get<std::string>());
+    const std::string filename  = this->trim(a_R["file"].get<std::string>());
+    const std::string startRead = this->trim(a_R["header"].get<std::string>());
+    const std::string stopRead  = "";
+
+    const int xColumn = a_R["E/N"].get<int>();
+    const int yColumn = a_R["temperature"].get<int>();
+    const int zColumn = a_R["rate"].get<int>();
+
+    const std::vector<int>         numPoints = a_R["points"].get<std::vector<int>>();
+    const std::vector<std::string> spacing   = a_R["spacing"].get<std::vector<std::string>>();
+
+    if (numPoints.size() != 2)
+      this->throwParserError(baseError + "and got 'table E/N T' but 'points' must be an array with two entries");
+    if (spacing.size() != 2)
+      this->throwParserError(baseError + "and got 'table E/N T' but 'spacing' must be an array with two entries");
+
+    // Figure out whose temperature we use. Neutral species use the gas temperature.
+    const bool isPlasmaT  = this->isPlasmaSpecies(speciesT);
+    const bool isNeutralT = this->isNeutralSpecies(speciesT);
+
+    if (!(isPlasmaT || isNeutralT))
+      this->throwParserError(baseError + "and got 'table E/N T' but do not know species '" + speciesT + "'");
+
+    const int speciesIdx = isPlasmaT ? m_cdrSpeciesMap.at(speciesT) : -1;
+
+    // Throw an error if the input file does not exist.
+    if (!(this->doesFileExist(filename)))
+      this->throwParserError(baseError + "and got 'table E/N T' but file '" + filename + "' does not exist");
+
+    // Read the table. The E/N data is put in the first column, the temperatures in the second column, and the rates in the third column.
+    LookupTable2D<Real, 1> reactionTable =
+      DataParser::fractionalFileReadASCII2D(filename, startRead, stopRead, xColumn, yColumn, zColumn);
+
+    // If the table is empty then it's an error.
+    if (reactionTable.getRawData().size() == 0) {
+      this->throwParserError(baseError + "and got 'table E/N T' but table is empty. This is probably an error");
+    }
+
+    // Optional truncation of the E/N range.
+    if (a_R.contains("min E/N") && a_R.contains("max E/N")) {
+      const Real minEN = a_R["min E/N"].get<Real>();
+      const Real maxEN = a_R["max E/N"].get<Real>();
+
+      if (maxEN < minEN)
+        this->throwParserError(baseError + "and got 'table E/N T' but can't have 'max E/N' < 'min E/N'");
+
+      reactionTable.truncate(minEN, maxEN, 0);
+    }
+
+    // Figure out the table spacing along each axis.
+    std::array<LookupTable::Spacing, 2> tableSpacing;
+    std::array<size_t, 2>               tablePoints;
+
+    for (int dir = 0; dir < 2; dir++) {
+      const std::string s = this->trim(spacing[dir]);
+
+      if (s == "uniform") {
+        tableSpacing[dir] = LookupTable::Spacing::Uniform;
+      }
+      else if (s == "exponential") {
+        tableSpacing[dir] = LookupTable::Spacing::Exponential;
+      }
+      else {
+        this->throwParserError(baseError + "and got 'table E/N T' but 'spacing' field = '" + s + "' which is not supported");
+      }
+
+      tablePoints[dir] = numPoints[dir];
+    }
+
+    // Format the table. This throws if the data is not on a tensor-product grid.
+    try {
+      reactionTable.prepareTable(tablePoints, tableSpacing);
+    }
+    catch (const std::exception& e) {
+      this->throwParserError(baseError + "and got 'table E/N T' but could not prepare table (" + e.what() + ")");
+    }
+
+    // Check if we should dump the table to file so that users can debug.
+    if (a_R.contains("dump")) {
+      const std::string dumpFile = a_R["dump"].get<std::string>();
+      reactionTable.writeStructuredData(dumpFile);
+    }
+
+    // Add the tabulated rate and identifier.
+    m_plasmaReactionLookup.emplace(std::make_pair(a_reactionIndex, LookupMethod::TableENT));
+    m_plasmaReactionTablesENT.emplace(std::make_pair(a_reactionIndex, std::make_pair(speciesIdx, reactionTable)));
+  }
   else if (lookup == "functionEN expA") {
     if (!(a_R.contains("c1")))
       this->throwParserError(baseError + "and got 'functionEN expA' but field 'c1' is required but not specified");
@@ -4249,28 +4539,31 @@ CdrPlasmaJSON::getPlotVariables(const Vector<Real>     a_cdrDensities,
     ret.push_back(m_gasDensity(a_pos));
   }
 
-  for (const auto& m : m_plasmaReactionPlot) {
-    if (m.second) {
-      const int reactionIndex = m.first;
+  // Reaction rates.
+  std::vector<Real> coefficients;
+  std::vector<Real> rates;
+
+  this->computePlasmaReactionCoefficients(coefficients,
+                                          cdrDensities,
+                                          cdrMobilities,
+                                          cdrDiffusionCoefficients,
+                                          cdrTemperatures,
+                                          cdrEnergies,
+                                          cdrGradients,
+                                          a_pos,
+                                          a_E,
+                                          E,
+                                          Etd,
+                                          N,
+                                          alpha,
+                                          eta,
+                                          a_time);
 
-      // Compute the reaction rate for the current reaction.
-      const Real k = this->computePlasmaReactionRate(reactionIndex,
-                                                     cdrDensities,
-                                                     cdrMobilities,
-                                                     cdrDiffusionCoefficients,
-                                                     cdrTemperatures,
-                                                     cdrEnergies,
-                                                     cdrGradients,
-                                                     a_pos,
-                                                     a_E,
-                                                     E,
-                                                     Etd,
-                                                     N,
-                                                     alpha,
-                                                     eta,
-                                                     a_time);
+  this->computePlasmaReactionRates(rates, coefficients, cdrDensities);
 
-      ret.push_back(k);
+  for (const auto& m : m_plasmaReactionPlot) {
+    if (m.second) {
+      ret.push_back(rates[m.first]);
     }
   }
 
@@ -4624,152 +4917,192 @@ CdrPlasmaJSON::computePlasmaReactionRate(const int&                   a_reaction
                                          const Real&                  a_eta,
                                          const Real&                  a_time) const
 {
-  const LookupMethod&          method   = m_plasmaReactionLookup.at(a_reactionIndex);
-  const CdrPlasmaReactionJSON& reaction = m_plasmaReactions[a_reactionIndex];
+  CH_TIME("CdrPlasmaJSON::computePlasmaReactionRate");
 
-  // Get list of reactants and products.
-  const std::list<int>& plasmaReactants  = reaction.getPlasmaReactants();
-  const std::list<int>& neutralReactants = reaction.getNeutralReactants();
+  CH_assert(a_reactionIndex >= 0 && a_reactionIndex < static_cast<int>(m_compiledReactions.lookup.size()));
 
-  // Figure out how to compute the reaction rate.
-  Real k = 0.0;
+  // TLDR: This is a deprecated wrapper that is kept for user code that calls (or overrides) the old per-reaction function. The rates are
+  //       computed from the compiled reaction network, which evaluates all reactions in one go.
+  std::vector<Real> coefficients;
+  std::vector<Real> rates;
 
-  // Various ways of computing the reaction rate.
-  switch (method) {
-  case LookupMethod::Constant: {
-    k = m_plasmaReactionConstants.at(a_reactionIndex);
+  this->computePlasmaReactionCoefficients(coefficients,
+                                          a_cdrDensities,
+                                          a_cdrMobilities,
+                                          a_cdrDiffusionCoefficients,
+                                          a_cdrTemperatures,
+                                          a_cdrEnergies,
+                                          a_cdrGradients,
+                                          a_pos,
+                                          a_vectorE,
+                                          a_E,
+                                          a_Etd,
+                                          a_N,
+                                          a_alpha,
+                                          a_eta,
+                                          a_time);
 
-    for (const auto& n : neutralReactants) {
-      k *= (m_neutralSpeciesDensities[n])(a_pos);
-    }
+  this->computePlasmaReactionRates(rates, coefficients, a_cdrDensities);
 
-    break;
-  }
-  case LookupMethod::FunctionEN: {
-    k = m_plasmaReactionFunctionsEN.at(a_reactionIndex)(a_E, a_N);
+  return rates[a_reactionIndex];
+}
 
-    for (const auto& n : neutralReactants) {
-      k *= (m_neutralSpeciesDensities[n])(a_pos);
-    }
+void
+CdrPlasmaJSON::computePlasmaReactionCoefficients(std::vector<Real>&           a_coefficients,
+                                                 const std::vector<Real>&     a_cdrDensities,
+                                                 const std::vector<Real>&     a_cdrMobilities,
+                                                 const std::vector<Real>&     a_cdrDiffusionCoefficients,
+                                                 const std::vector<Real>&     a_cdrTemperatures,
+                                                 const std::vector<Real>&     a_cdrEnergies,
+                                                 const std::vector<RealVect>& a_cdrGradients,
+                                                 const RealVect&              a_pos,
+                                                 const RealVect&              a_vectorE,
+                                                 const Real&                  a_E,
+                                                 const Real&                  a_Etd,
+                                                 const Real&                  a_N,
+                                                 const Real&                  a_alpha,
+                                                 const Real&                  a_eta,
+                                                 const Real&                  a_time) const
+{
+  const CompiledReactionNetwork& net = m_compiledReactions;
 
-    break;
+  const int numReactions = net.lookup.size();
+
+  a_coefficients.resize(numReactions);
+
+  // TLDR: Quantities that are shared between the reactions (neutral densities and gas temperature) are evaluated once. We then run
+  //       through the compiled network where only the rate lookup itself depends on the reaction type. Neutral densities, efficiencies,
+  //       and the Soloviev correction are applied through the flattened arrays.
+  std::vector<Real> neutralDensities(m_neutralSpeciesDensities.size(), 0.0);
+  for (const auto& n : net.neutralSpecies) {
+    neutralDensities[n] = (m_neutralSpeciesDensities[n])(a_pos);
   }
-  case LookupMethod::TableEN: {
-    // Recall; the reaction tables are stored as (E/N, rate/N) so we need to extract mu from that.
-    const LookupTable1D<Real, 1>& reactionTable = m_plasmaReactionTablesEN.at(a_reactionIndex);
 
-    // Get the reaction rate.
-    k = reactionTable.interpolate<1>(a_Etd);
+  const Real gasTemperature = net.needsGasTemperature ? m_gasTemperature(a_pos) : 0.0;
 
-    // Multiply by neutral species densities.
-    for (const auto& n : neutralReactants) {
-      k *= (m_neutralSpeciesDensities[n])(a_pos);
-    }
+  for (int i = 0; i < numReactions; i++) {
+    const std::array<int, 2>& species = net.species[i];
 
-    break;
-  }
-  case LookupMethod::TableEnergy: {
-    const int&              speciesIndex  = m_plasmaReactionTablesEnergy.at(a_reactionIndex).first;
-    const LookupTable1D<Real, 1>& reactionTable = m_plasmaReactionTablesEnergy.at(a_reactionIndex).second;
+    Real k = 0.0;
+
+    switch (net.lookup[i]) {
+    case LookupMethod::Constant: {
+      k = net.constants[i];
 
-    const Real energy = a_cdrEnergies[speciesIndex];
+      break;
+    }
+    case LookupMethod::FunctionEN: {
+      k = (*net.functionsEN[i])(a_E, a_N);
 
-    // Get the reaction rate.
-    k = reactionTable.interpolate<1>(energy);
+      break;
+    }
+    case LookupMethod::TableEN: {
+      // Recall; the reaction tables are stored as (E/N, rate/N).
+      k = net.tables[i]->interpolate<1>(a_Etd);
 
-    // Multiply by neutral species densities.
-    for (const auto& n : neutralReactants) {
-      k *= (m_neutralSpeciesDensities[n])(a_pos);
+      break;
     }
+    case LookupMethod::TableEnergy: {
+      k = net.tables[i]->interpolate<1>(a_cdrEnergies[species[0]]);
 
-    break;
-  }
-  case LookupMethod::AlphaV: {
-    const int idx = m_plasmaReactionAlphaV.at(a_reactionIndex);
+      break;
+    }
+    case LookupMethod::TableENT: {
+      const Real T = (species[0] < 0) ? gasTemperature : a_cdrTemperatures[species[0]];
 
-    k = a_alpha * a_E * a_cdrMobilities[idx];
+      k = net.tables2D[i]->interpolate<2>({a_Etd, T});
 
-    break;
-  }
-  case LookupMethod::EtaV: {
-    const int idx = m_plasmaReactionEtaV.at(a_reactionIndex);
+      break;
+    }
+    case LookupMethod::AlphaV: {
+      k = a_alpha * a_E * a_cdrMobilities[species[0]];
 
-    k = a_eta * a_E * a_cdrMobilities[idx];
+      break;
+    }
+    case LookupMethod::EtaV: {
+      k = a_eta * a_E * a_cdrMobilities[species[0]];
 
-    break;
-  }
-  case LookupMethod::FunctionT: {
-    const std::pair<int, FunctionT>& p = m_plasmaReactionFunctionsT.at(a_reactionIndex);
+      break;
+    }
+    case LookupMethod::FunctionT: {
+      const Real T = (species[0] < 0) ? gasTemperature : a_cdrTemperatures[species[0]];
 
-    const int idx = p.first;
-    const FunctionT& func = p.second;
+      k = (*net.functionsT[i])(T);
 
-    const Real T = (idx < 0) ? m_gasTemperature(a_pos): a_cdrTemperatures[idx];
+      break;
+    }
+    case LookupMethod::FunctionTT: {
+      const Real T1 = (species[0] < 0) ? gasTemperature : a_cdrTemperatures[species[0]];
+      const Real T2 = (species[1] < 0) ? gasTemperature : a_cdrTemperatures[species[1]];
 
-    k = func(T);
+      k = (*net.functionsTT[i])(T1, T2);
 
-    for (const auto& n : neutralReactants) {
-      k *= (m_neutralSpeciesDensities[n])(a_pos);
+      break;
     }
+    default: {
+      MayDay::Error("CdrPlasmaJSON::computePlasmaReactionCoefficients -- logic bust");
 
-    break;
-  }
-  case LookupMethod::FunctionTT: {
-    const std::tuple<int, int, FunctionTT>& tup = m_plasmaReactionFunctionsTT.at(a_reactionIndex);
+      break;
+    }
+    }
 
-    const int         idx1 = std::get<0>(tup);
-    const int         idx2 = std::get<1>(tup);
-    const FunctionTT& func = std::get<2>(tup);
+    // Multiply by neutral species densities. This range is empty for alpha*v and eta*v reactions.
+    for (int j = net.neutralReactantOffsets[i]; j < net.neutralReactantOffsets[i + 1]; j++) {
+      k *= neutralDensities[net.neutralReactants[j]];
+    }
 
-    const Real T1 = (idx1 < 0) ? m_gasTemperature(a_pos) : a_cdrTemperatures[idx1];
-    const Real T2 = (idx2 < 0) ? m_gasTemperature(a_pos) : a_cdrTemperatures[idx2];
+    // Modify by user-provided reaction efficiencies and scales.
+    k *= (*net.efficiencies[i])(a_E, a_pos);
 
-    k = func(T1, T2);
+    // This is a hook that uses the Soloviev correction. It modifies the reaction rate according to k = k * (1 + (E.D*grad(n))/(K * n * E^2) where
+    // K is the electron mobility.
+    const int solovievSpecies = net.solovievSpecies[i];
 
-    for (const auto& n : neutralReactants) {
-      k *= (m_neutralSpeciesDensities[n])(a_pos);
-    }
+    if (solovievSpecies >= 0) {
+      const Real&     n  = a_cdrDensities[solovievSpecies];
+      const Real&     mu = a_cdrMobilities[solovievSpecies];
+      const Real&     D  = a_cdrDiffusionCoefficients[solovievSpecies];
+      const RealVect& g  = a_cdrGradients[solovievSpecies];
 
-    break;
-  }
-  default: {
-    MayDay::Error("CdrPlasmaJSON::computePlasmaReactionRate -- logic bust");
+      // Compute correction factor 1 + E.(D*grad(n))/(K * n * E^2).
+      constexpr Real safety = 1.0;
 
-    break;
-  }
-  }
+      Real fcorr = 1.0 + (a_vectorE.dotProduct(D * g)) / (safety + n * mu * a_E * a_E);
+
+      fcorr = std::max(fcorr, (Real)0.0);
+      fcorr = std::min(fcorr, (Real)1.0);
+
+      k *= fcorr;
+    }
 
-  // Now multiply by the rest of the left-hand side -- all neutrals should be done above so we are only missing the plasma
-  // reactants. After this, the reaction is essentially k -> k * n[A] * n[B] * ... as it should be. 
-  for (const auto& r : plasmaReactants) {
-    k *= a_cdrDensities[r];
+    a_coefficients[i] = k;
   }
+}
 
-  // Modify by user-provided reaction efficiencies and scales.
-  k *= m_plasmaReactionEfficiencies.at(a_reactionIndex)(a_E, a_pos);
+void
+CdrPlasmaJSON::computePlasmaReactionRates(std::vector<Real>&       a_rates,
+                                          const std::vector<Real>& a_coefficients,
+                                          const std::vector<Real>& a_cdrDensities) const noexcept
+{
+  const CompiledReactionNetwork& net = m_compiledReactions;
 
-  // This is a hook that uses the Soloviev correction. It modifies the reaction rate according to k = k * (1 + (E.D*grad(n))/(K * n * E^2) where
-  // K is the electron mobility.
-  if ((m_plasmaReactionSolovievCorrection.at(a_reactionIndex)).first) {
-    const int species = (m_plasmaReactionSolovievCorrection.at(a_reactionIndex)).second;
+  const int numReactions = net.lookup.size();
 
-    const Real&     n  = a_cdrDensities[species];
-    const Real&     mu = a_cdrMobilities[species];
-    const Real&     D  = a_cdrDiffusionCoefficients[species];
-    const RealVect& g  = a_cdrGradients[species];
+  CH_assert(a_coefficients.size() == numReactions);
 
-    // Compute correction factor 1 + E.(D*grad(n))/(K * n * E^2).
-    constexpr Real safety = 1.0;
+  a_rates.resize(numReactions);
 
-    Real fcorr = 1.0 + (a_vectorE.dotProduct(D * g)) / (safety + n * mu * a_E * a_E);
+  // All neutrals are included in the coefficient so we are only missing the plasma reactants. After this, the reaction is
+  // essentially k -> k * n[A] * n[B] * ... as it should be.
+  for (int i = 0; i < numReactions; i++) {
+    Real k = a_coefficients[i];
 
-    fcorr = std::max(fcorr, (Real)0.0);
-    fcorr = std::min(fcorr, (Real)1.0);
+    for (int j = net.plasmaReactantOffsets[i]; j < net.plasmaReactantOffsets[i + 1]; j++) {
+      k *= a_cdrDensities[net.plasmaReactants[j]];
+    }
 
-    k *= fcorr;
+    a_rates[i] = k;
   }
-
-  return k;
 }
 
 Real
@@ -5461,6 +5794,13 @@ CdrPlasmaJSON::integrateReactions(std::vector<Real>&          a_cdrDensities,
                                   const Real                  a_time,
                                   const Real                  a_kappa) const
 {
+  // The adaptive integrator selects its own substeps.
+  if (m_reactionIntegrator == ReactionIntegrator::Rosenbrock) {
+    this->integrateReactionsRosenbrock(a_cdrDensities, a_photonProduction, a_cdrGradients, a_E, a_pos, a_dx, a_dt, a_time, a_kappa);
+
+    return;
+  }
+
   // Do substeps. We happen to know that we have m_reactionIntegrator.second substeps for the whole integration interval.
   const int numSteps = std::ceil(a_dt / m_chemistryDt);
 
@@ -5531,25 +5871,34 @@ CdrPlasmaJSON::integrateReactions(std::vector<Real>&          a_cdrDensities,
 }
 
 void
-CdrPlasmaJSON::fillSourceTerms(std::vector<Real>&          a_cdrSources,
-                               std::vector<Real>&          a_rteSources,
-                               const std::vector<Real>     a_cdrDensities,
-                               const std::vector<RealVect> a_cdrGradients,
-                               const RealVect              a_E,
-                               const RealVect              a_pos,
-                               const Real                  a_dx,
-                               const Real                  a_time,
-                               const Real                  a_kappa) const
+CdrPlasmaJSON::fillSourceTerms(std::vector<Real>&           a_cdrSources,
+                               std::vector<Real>&           a_rteSources,
+                               const std::vector<Real>&     a_cdrDensities,
+                               const std::vector<RealVect>& a_cdrGradients,
+                               const RealVect&              a_E,
+                               const RealVect&              a_pos,
+                               const Real                   a_dx,
+                               const Real                   a_time,
+                               const Real                   a_kappa) const
 {
   if (m_verbose) {
     pout() << "CdrPlasmaJSON::fillSourceTerms" << endl;
   }
 
+  // Per-thread storage for the species properties and the reaction coefficients/rates. These are kept after we return so that
+  // integrateReactionsRosenbrock can reuse them for the Jacobian.
+  ChemistryWorkspace& ws = s_chemistryWorkspace;
+
   // These may or may not be needed.
-  const std::vector<Real> cdrMobilities            = this->computePlasmaSpeciesMobilities(a_pos, a_E, a_cdrDensities);
-  const std::vector<Real> cdrDiffusionCoefficients = this->computePlasmaSpeciesDiffusion(a_pos, a_E, a_cdrDensities);
-  const std::vector<Real> cdrTemperatures          = this->computePlasmaSpeciesTemperatures(a_pos, a_E, a_cdrDensities);
-  const std::vector<Real> cdrEnergies              = this->computePlasmaSpeciesEnergies(a_pos, a_E, a_cdrDensities);
+  ws.mobilities   = this->computePlasmaSpeciesMobilities(a_pos, a_E, a_cdrDensities);
+  ws.diffusion    = this->computePlasmaSpeciesDiffusion(a_pos, a_E, a_cdrDensities);
+  ws.temperatures = this->computePlasmaSpeciesTemperatures(a_pos, a_E, a_cdrDensities);
+  ws.energies     = this->computePlasmaSpeciesEnergies(a_pos, a_E, a_cdrDensities);
+
+  const std::vector<Real>& cdrMobilities            = ws.mobilities;
+  const std::vector<Real>& cdrDiffusionCoefficients = ws.diffusion;
+  const std::vector<Real>& cdrTemperatures          = ws.temperatures;
+  const std::vector<Real>& cdrEnergies              = ws.energies;
 
   // Electric field and reduce electric field.
   const Real E   = a_E.vectorLength();
@@ -5570,114 +5919,242 @@ CdrPlasmaJSON::fillSourceTerms(std::vector<Real>&          a_cdrSources,
     S = 0.0;
   }
 
-  // Plasma reactions loop
-  for (int i = 0; i < m_plasmaReactions.size(); i++) {
+  // Compute the rates. These are volumetric rates in units of #/(m^3 * s) (or #/(m^2 * s) for Cartesian 2D).
+  const CompiledReactionNetwork& net = m_compiledReactions;
 
-    // Reaction and species involved in the reaction.
-    const CdrPlasmaReactionJSON& reaction = m_plasmaReactions[i];
+  std::vector<Real>& coefficients = ws.coefficients;
+  std::vector<Real>& rates        = ws.rates;
 
-    const std::list<int>& plasmaReactants = reaction.getPlasmaReactants();
-    const std::list<int>& plasmaProducts  = reaction.getPlasmaProducts();
-    const std::list<int>& photonProducts  = reaction.getPhotonProducts();
-
-    // Compute the rate. This returns a volumetric rate in units of #/(m^3 * s) (or #/(m^2 * s) for Cartesian 2D).
-    const Real k = this->computePlasmaReactionRate(i,
-                                                   a_cdrDensities,
-                                                   cdrMobilities,
-                                                   cdrDiffusionCoefficients,
-                                                   cdrTemperatures,
-                                                   cdrEnergies,
-                                                   a_cdrGradients,
-                                                   a_pos,
-                                                   a_E,
-                                                   E,
-                                                   Etd,
-                                                   N,
-                                                   alpha,
-                                                   eta,
-                                                   a_time);
+  this->computePlasmaReactionCoefficients(coefficients,
+                                          a_cdrDensities,
+                                          cdrMobilities,
+                                          cdrDiffusionCoefficients,
+                                          cdrTemperatures,
+                                          cdrEnergies,
+                                          a_cdrGradients,
+                                          a_pos,
+                                          a_E,
+                                          E,
+                                          Etd,
+                                          N,
+                                          alpha,
+                                          eta,
+                                          a_time);
+
+  this->computePlasmaReactionRates(rates, coefficients, a_cdrDensities);
+
+  // Plasma reactions loop
+  for (int i = 0; i < rates.size(); i++) {
+    const Real k = rates[i];
 
     // Remove consumption on the left-hand side.
-    for (const auto& r : plasmaReactants) {
-      a_cdrSources[r] -= k;
+    for (int j = net.plasmaReactantOffsets[i]; j < net.plasmaReactantOffsets[i + 1]; j++) {
+      a_cdrSources[net.plasmaReactants[j]] -= k;
     }
 
     // Add mass on the right-hand side.
-    for (const auto& p : plasmaProducts) {
-      a_cdrSources[p] += k;
+    for (int j = net.plasmaProductOffsets[i]; j < net.plasmaProductOffsets[i + 1]; j++) {
+      a_cdrSources[net.plasmaProducts[j]] += k;
     }
 
     // Add photons on the right-hand side.
-    for (const auto& p : photonProducts) {
-      a_rteSources[p] += k;
+    for (int j = net.photonProductOffsets[i]; j < net.photonProductOffsets[i + 1]; j++) {
+      a_rteSources[net.photonProducts[j]] += k;
     }
 
     // If there is an energy loss associated with this reaction, we need to add the losses to the corresponding energy transport solvers.
-    if (m_plasmaReactionHasEnergyLoss.at(i)) {
-      const auto& energyLosses = m_plasmaReactionEnergyLosses.at(i);
+    for (int j = net.energyLossOffsets[i]; j < net.energyLossOffsets[i + 1]; j++) {
+      const int& transportIndex = net.energyLossTransport[j];
+      const int& energyIndex    = net.energyLossEnergy[j];
+      const Real lossFactor     = net.energyLossFactor[j];
 
-      for (const auto& curReactionLoss : energyLosses) {
-        const int& transportIndex = curReactionLoss.first;
-        const int& energyIndex    = m_cdrTransportEnergyMap.at(transportIndex);
+      switch (net.energyLossMethod[j]) {
+      case ReactiveEnergyLoss::AddMean: {
+        a_cdrSources[energyIndex] += lossFactor * cdrEnergies[transportIndex] * k;
+
+        break;
+      }
+      case ReactiveEnergyLoss::SubtractMean: {
+        a_cdrSources[energyIndex] -= lossFactor * cdrEnergies[transportIndex] * k;
+
+        break;
+      }
+      case ReactiveEnergyLoss::AddDirect: {
+        a_cdrSources[energyIndex] += k;
+
+        break;
+      }
+      case ReactiveEnergyLoss::SubtractDirect: {
+        a_cdrSources[energyIndex] -= k;
+
+        break;
+      }
+      case ReactiveEnergyLoss::External: {
+        a_cdrSources[energyIndex] += lossFactor * k;
+
+        break;
+      }
+      }
+    }
+  }
+
+  // Energy solvers should be incremented by v * n - D * grad(n)
+  for (const auto& m : m_cdrTransportEnergyMap) {
+    const int transportIdx = m.first;
+    const int energyIdx    = m.second;
+
+    const Real     mu    = cdrMobilities[transportIdx];
+    const Real     D     = cdrDiffusionCoefficients[transportIdx];
+    const Real     n     = a_cdrDensities[transportIdx];
+    const RealVect gradn = a_cdrGradients[transportIdx];
+
+    const int Z = m_cdrSpecies[transportIdx]->getChargeNumber();
+
+    int sgn = 0;
+
+    if (Z > 0) {
+      sgn = 1;
+    }
+    else if (Z < 0) {
+      sgn = -1;
+    }
+
+    const RealVect flux = sgn * n * mu * a_E - (D * gradn);
+
+    a_cdrSources[energyIdx] += -flux.dotProduct(a_E);
+  }
+}
+
+void
+CdrPlasmaJSON::computeReactionJacobian(std::vector<Real>&       a_jacobian,
+                                       const std::vector<Real>& a_coefficients,
+                                       const std::vector<Real>& a_cdrDensities,
+                                       const std::vector<Real>& a_cdrEnergies) const noexcept
+{
+  if (m_verbose) {
+    pout() << "CdrPlasmaJSON::computeReactionJacobian" << endl;
+  }
+
+  // TLDR: Each reaction has a rate R = k * n[A] * n[B] * ... so with k fixed we have dR/dn[A] = k * n[B] * ..., i.e. the product over all
+  //       the other reactants. For each reactant occurrence we compute this derivative and distribute it to the species on both sides
+  //       of the reaction (and to the energy equations).
+
+  const int N = m_numCdrSpecies;
+
+  a_jacobian.assign(N * N, 0.0);
+
+  const CompiledReactionNetwork& net = m_compiledReactions;
+
+  for (int i = 0; i < a_coefficients.size(); i++) {
+    const int reactantsBegin = net.plasmaReactantOffsets[i];
+    const int reactantsEnd   = net.plasmaReactantOffsets[i + 1];
+
+    // Derivative with respect to each reactant occurrence.
+    for (int r = reactantsBegin; r < reactantsEnd; r++) {
+      const int j = net.plasmaReactants[r];
+
+      Real dRdn = a_coefficients[i];
+      for (int other = reactantsBegin; other < reactantsEnd; other++) {
+        if (other != r) {
+          dRdn *= a_cdrDensities[net.plasmaReactants[other]];
+        }
+      }
+
+      for (int l = reactantsBegin; l < reactantsEnd; l++) {
+        a_jacobian[net.plasmaReactants[l] * N + j] -= dRdn;
+      }
+
+      for (int l = net.plasmaProductOffsets[i]; l < net.plasmaProductOffsets[i + 1]; l++) {
+        a_jacobian[net.plasmaProducts[l] * N + j] += dRdn;
+      }
+
+      // Energy losses/gains, with the mean energies kept fixed.
+      for (int l = net.energyLossOffsets[i]; l < net.energyLossOffsets[i + 1]; l++) {
+        const int& transportIndex = net.energyLossTransport[l];
+        const int& energyIndex    = net.energyLossEnergy[l];
+        const Real lossFactor     = net.energyLossFactor[l];
 
-        const auto& lossMethod = (curReactionLoss.second).first;
-        const auto& lossFactor = (curReactionLoss.second).second;
+        Real factor = 0.0;
 
-        switch (lossMethod) {
+        switch (net.energyLossMethod[l]) {
         case ReactiveEnergyLoss::AddMean: {
-          a_cdrSources[energyIndex] += lossFactor * cdrEnergies[transportIndex] * k;
+          factor = lossFactor * a_cdrEnergies[transportIndex];
 
           break;
         }
         case ReactiveEnergyLoss::SubtractMean: {
-          a_cdrSources[energyIndex] -= lossFactor * cdrEnergies[transportIndex] * k;
+          factor = -lossFactor * a_cdrEnergies[transportIndex];
 
           break;
         }
         case ReactiveEnergyLoss::AddDirect: {
-          a_cdrSources[energyIndex] += k;
+          factor = 1.0;
 
           break;
         }
         case ReactiveEnergyLoss::SubtractDirect: {
-          a_cdrSources[energyIndex] -= k;
+          factor = -1.0;
 
           break;
         }
         case ReactiveEnergyLoss::External: {
-          a_cdrSources[energyIndex] += lossFactor * k;
+          factor = lossFactor;
 
           break;
         }
         }
+
+        a_jacobian[energyIndex * N + j] += factor * dRdn;
       }
     }
   }
+}
 
-  // Energy solvers should be incremented by v * n - D * grad(n)
-  for (const auto& m : m_cdrTransportEnergyMap) {
-    const int transportIdx = m.first;
-    const int energyIdx    = m.second;
-
-    const Real     mu    = cdrMobilities[transportIdx];
-    const Real     D     = cdrDiffusionCoefficients[transportIdx];
-    const Real     n     = a_cdrDensities[transportIdx];
-    const RealVect gradn = a_cdrGradients[transportIdx];
+void
+CdrPlasmaJSON::solveDenseSystem(std::vector<Real>& a_A, std::vector<Real>& a_b) const noexcept
+{
+  const int N = a_b.size();
 
-    const int Z = m_cdrSpecies[transportIdx]->getChargeNumber();
+  CH_assert(a_A.size() == N * N);
 
-    int sgn = 0;
+  // Forward elimination with partial pivoting.
+  for (int col = 0; col < N; col++) {
+    int pivot = col;
+    for (int row = col + 1; row < N; row++) {
+      if (std::abs(a_A[row * N + col]) > std::abs(a_A[pivot * N + col])) {
+        pivot = row;
+      }
+    }
 
-    if (Z > 0) {
-      sgn = 1;
+    if (pivot != col) {
+      for (int k = col; k < N; k++) {
+        std::swap(a_A[col * N + k], a_A[pivot * N + k]);
+      }
+      std::swap(a_b[col], a_b[pivot]);
     }
-    else if (Z < 0) {
-      sgn = -1;
+
+    const Real diag = a_A[col * N + col];
+
+    for (int row = col + 1; row < N; row++) {
+      const Real factor = a_A[row * N + col] / diag;
+
+      if (factor != 0.0) {
+        for (int k = col; k < N; k++) {
+          a_A[row * N + k] -= factor * a_A[col * N + k];
+        }
+        a_b[row] -= factor * a_b[col];
+      }
     }
+  }
 
-    const RealVect flux = sgn * n * mu * a_E - (D * gradn);
+  // Back substitution.
+  for (int row = N - 1; row >= 0; row--) {
+    Real sum = a_b[row];
+    for (int k = row + 1; k < N; k++) {
+      sum -= a_A[row * N + k] * a_b[k];
+    }
 
-    a_cdrSources[energyIdx] += -flux.dotProduct(a_E);
+    a_b[row] = sum / a_A[row * N + row];
   }
 }
 
@@ -5823,4 +6300,168 @@ CdrPlasmaJSON::integrateReactionsExplicitRK4(std::vector<Real>&          a_cdrDe
   }
 }
 
+void
+CdrPlasmaJSON::integrateReactionsRosenbrock(std::vector<Real>&           a_cdrDensities,
+                                            std::vector<Real>&           a_photonProduction,
+                                            const std::vector<RealVect>& a_cdrGradients,
+                                            const RealVect&              a_E,
+                                            const RealVect&              a_pos,
+                                            const Real                   a_dx,
+                                            const Real                   a_dt,
+                                            const Real                   a_time,
+                                            const Real                   a_kappa) const
+{
+  if (m_verbose) {
+    pout() << "CdrPlasmaJSON::integrateReactionsRosenbrock" << endl;
+  }
+
+  // TLDR: This is the two-stage Rosenbrock method ROS2 by Verwer et. al. For dy/dt = f(y) the update is
+  //
+  //          W * k1 = f(y)
+  //          W * k2 = f(y + dt*k1) - 2*k1
+  //          y(t+dt) = y + 1.5*dt*k1 + 0.5*dt*k2
+  //
+  //       where W = I - gamma*dt*J and gamma = 1 + 1/sqrt(2). The method is L-stable and second order for any matrix J, so the
+  //       approximate Jacobian from computeReactionJacobian is fine. The embedded first order solution is y + dt*k1 (the linearly
+  //       implicit Euler method), which gives the error estimate 0.5*dt*(k1 + k2). The photon production is integrated with the
+  //       trapezoidal rule using the source terms at the beginning and end of each substep.
+  //
+  //       The Jacobian only depends on the state, so it is only recomputed after accepted substeps. It is computed from the coefficients
+  //       and species energies that fillSourceTerms left in the workspace when it computed f(y) for the same state.
+
+  const Real     gamma     = 1.0 + 1.0 / std::sqrt(2.0);
+  constexpr Real safety    = 0.9;
+  constexpr Real minFactor = 0.2;
+  constexpr Real maxFactor = 5.0;
+  constexpr int  maxSteps  = 100000;
+
+  const int N = m_numCdrSpecies;
+
+  Real dt = std::min(a_dt, m_chemistryDt);
+
+  // Per-thread storage, which is only reallocated if the number of species changed.
+  ChemistryWorkspace& ws = s_chemistryWorkspace;
+
+  ws.define(N, m_numRtSpecies);
+
+  std::vector<Real>& jacobian = ws.jacobian;
+  std::vector<Real>& W        = ws.W;
+  std::vector<Real>& k1       = ws.k1;
+  std::vector<Real>& k2       = ws.k2;
+  std::vector<Real>& y1       = ws.y1;
+  std::vector<Real>& yNew     = ws.yNew;
+  std::vector<Real>& f0       = ws.f0;
+  std::vector<Real>& f1       = ws.f1;
+  std::vector<Real>& rte0     = ws.rte0;
+  std::vector<Real>& rte1     = ws.rte1;
+  std::vector<Real>& rteNew   = ws.rteNew;
+
+  for (auto& p : a_photonProduction) {
+    p = 0.0;
+  }
+
+  const Real tEnd = a_time + a_dt;
+
+  Real time = a_time;
+  int  step = 0;
+
+  this->fillSourceTerms(f0, rte0, a_cdrDensities, a_cdrGradients, a_E, a_pos, a_dx, time, a_kappa);
+
+  bool needsJacobian = true;
+
+  while (time < tEnd && step < maxSteps) {
+    const Real h = std::min(dt, tEnd - time);
+
+    // ws.coefficients and ws.energies were computed together with f0, i.e. for the current state.
+    if (needsJacobian) {
+      this->computeReactionJacobian(jacobian, ws.coefficients, a_cdrDensities, ws.energies);
+
+      needsJacobian = false;
+    }
+
+    // First stage.
+    for (int i = 0; i < N; i++) {
+      for (int j = 0; j < N; j++) {
+        W[i * N + j] = ((i == j) ? 1.0 : 0.0) - gamma * h * jacobian[i * N + j];
+      }
+      k1[i] = f0[i];
+    }
+
+    this->solveDenseSystem(W, k1);
+
+    // Second stage. The matrix was destroyed by the elimination so we need to rebuild it.
+    for (int i = 0; i < N; i++) {
+      y1[i] = a_cdrDensities[i] + h * k1[i];
+    }
+
+    this->fillSourceTerms(f1, rte1, y1, a_cdrGradients, a_E, a_pos, a_dx, time + h, a_kappa);
+
+    for (int i = 0; i < N; i++) {
+      for (int j = 0; j < N; j++) {
+        W[i * N + j] = ((i == j) ? 1.0 : 0.0) - gamma * h * jacobian[i * N + j];
+      }
+      k2[i] = f1[i] - 2.0 * k1[i];
+    }
+
+    this->solveDenseSystem(W, k2);
+
+    // New solution and error estimate.
+    Real err = 0.0;
+    for (int i = 0; i < N; i++) {
+      yNew[i] = a_cdrDensities[i] + 1.5 * h * k1[i] + 0.5 * h * k2[i];
+
+      const Real scale = m_chemistryAbsTol + m_chemistryRelTol * std::max(std::abs(a_cdrDensities[i]), std::abs(yNew[i]));
+      const Real e     = 0.5 * h * (k1[i] + k2[i]) / scale;
+
+      err += e * e;
+    }
+
+    err = (N > 0) ? std::sqrt(err / N) : 0.0;
+
+    const Real factor = std::min(maxFactor, std::max(minFactor, safety / std::sqrt(std::max(err, 1.E-10))));
+
+    // Accept the step if the error is small enough. Steps that have become too small are always accepted.
+    if (err <= 1.0 || h <= 1.E-12 * a_dt) {
+      this->fillSourceTerms(f0, rteNew, yNew, a_cdrGradients, a_E, a_pos, a_dx, time + h, a_kappa);
+
+      for (int i = 0; i < m_numRtSpecies; i++) {
+        a_photonProduction[i] += 0.5 * h * (rte0[i] + rteNew[i]);
+      }
+
+      std::copy(yNew.begin(), yNew.end(), a_cdrDensities.begin());
+      rte0.swap(rteNew);
+
+      time += h;
+
+      needsJacobian = true;
+    }
+
+    dt = h * factor;
+
+    step++;
+  }
+
+  if (step >= maxSteps) {
+    MayDay::Warning("CdrPlasmaJSON::integrateReactionsRosenbrock - maximum number of steps reached");
+  }
+}
+
+void
+CdrPlasmaJSON::ChemistryWorkspace::define(const int a_numCdrSpecies, const int a_numRtSpecies) noexcept
+{
+  const size_t N = a_numCdrSpecies;
+  const size_t M = a_numRtSpecies;
+
+  jacobian.resize(N * N);
+  W.resize(N * N);
+
+  for (auto* v : {&k1, &k2, &y1, &yNew, &f0, &f1}) {
+    v->resize(N);
+  }
+
+  for (auto* v : {&rte0, &rte1, &rteNew}) {
+    v->resize(M);
+  }
+}
+
 #include <CD_NamespaceFooter.H>
@@ -326,6 +326,10 @@ CdrPlasmaGodunovStepper::advance(const Real a_dt)
 
   Timer timer("CdrPlasmaGodunovStepper::advance");
 
+  // All field solves in this step are for the field at t + dt. Label the solutions with that time, since the multigrid solver
+  // stores its solutions by time and extrapolates them into initial guesses. The solver time (and so the voltage) is not changed.
+  m_fieldSolver->setSolutionTime(m_time + a_dt);
+
   // 1. Solve the transport problem. Note that we call advanceTransport which holds the implementation. This differs for explicit and semi-implicit formulations.
   CdrPlasmaGodunovStepper::advanceTransport(a_dt);
 
@@ -1202,6 +1206,16 @@ CdrPlasmaGodunovStepper::advanceTransportExplicitField(const Real a_dt)
   // phi^(k+1) = phi^k - dt*div(F) + dt*div(
 
   m_timer->startEvent("Transport advance");
+
+  // Species with implicit diffusion are advanced together after the advective advance, with phi^k in scratch and a zero source in scratch2.
+  const int numCdrSpecies = m_physics->getNumCdrSpecies();
+
+  Vector<EBAMRCellData*> implicitNewPhi(numCdrSpecies, nullptr);
+  Vector<EBAMRCellData*> implicitOldPhi(numCdrSpecies, nullptr);
+  Vector<EBAMRCellData*> implicitSource(numCdrSpecies, nullptr);
+
+  bool hasImplicitDiffusion = false;
+
   for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
     const int idx = solverIt.index();
 
@@ -1269,12 +1283,11 @@ CdrPlasmaGodunovStepper::advanceTransportExplicitField(const Real a_dt)
         DataOps::copy(scratch, phi);
         DataOps::setValue(scratch2, 0.0);
 
-        if (m_diffusionOrder == 1) {
-          solver->advanceEuler(phi, scratch, scratch2, a_dt);
-        }
-        else if (m_diffusionOrder == 2) {
-          solver->advanceCrankNicholson(phi, scratch, scratch2, a_dt);
-        }
+        implicitNewPhi[idx] = &phi;
+        implicitOldPhi[idx] = &scratch;
+        implicitSource[idx] = &scratch2;
+
+        hasImplicitDiffusion = true;
       }
       else {
         if (m_diffusionOrder == 1) {
@@ -1294,6 +1307,24 @@ CdrPlasmaGodunovStepper::advanceTransportExplicitField(const Real a_dt)
         }
       }
     }
+  }
+
+  if (hasImplicitDiffusion) {
+    const Vector<bool> converged =
+      m_cdr->advanceImplicitDiffusion(implicitNewPhi, implicitOldPhi, implicitSource, a_dt, m_diffusionOrder);
+
+    for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+      if (!converged[solverIt.index()] && m_verbosity > 2) {
+        pout() << "CdrPlasmaGodunovStepper::advanceTransportExplicitField - implicit diffusion did not converge for species '"
+               << solverIt()->getName() << "'" << endl;
+      }
+    }
+  }
+
+  for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+    RefCountedPtr<CdrSolver>& solver = solverIt();
+
+    EBAMRCellData& phi = solver->getPhi();
 
     // Floor mass or not?
     if (m_floor) {
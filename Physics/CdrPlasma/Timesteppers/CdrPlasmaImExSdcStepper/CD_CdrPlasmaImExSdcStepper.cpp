@@ -776,9 +776,13 @@ CdrPlasmaImExSdcStepper::integrate(const Real a_dt, const Real a_time, const boo
     EBAMRIVData&           sigma_mp1         = CdrPlasmaImExSdcStepper::getSigmaSolverK(m + 1);
     const Real             t_mp1             = m_tm[m + 1];
 
-    // Update electric field and stationary RTE equations
-    if (m_consistentE)
+    // Update electric field and stationary RTE equations. The field is computed at the end of the substep, so label the solution with
+    // that time (the multigrid solver stores its solutions by time and extrapolates them into initial guesses).
+    if (m_consistentE) {
+      m_fieldSolver->setSolutionTime(time + m_dtm[m]);
+
       CdrPlasmaImExSdcStepper::updateField(cdr_densities_mp1, sigma_mp1);
+    }
     if (m_consistentRTE) {
       if (m_rte->isStationary()) {
         CdrPlasmaImExSdcStepper::computeReactionNetwork(m + 1, time + m_dtm[m], m_dtm[m]);
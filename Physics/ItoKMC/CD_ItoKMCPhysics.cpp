@@ -21,6 +21,8 @@ using namespace Physics::ItoKMC;
 thread_local bool                                            ItoKMCPhysics::m_hasKMCSolver;
 thread_local KMCSolverType                                   ItoKMCPhysics::m_kmcSolver;
 thread_local KMCState                                        ItoKMCPhysics::m_kmcState;
+thread_local KMCSolverWorkspaceType                          ItoKMCPhysics::m_kmcWorkspace;
+thread_local KMCBatchSolverType                              ItoKMCPhysics::m_kmcBatchSolver;
 thread_local std::vector<std::shared_ptr<const KMCReaction>> ItoKMCPhysics::m_kmcReactionsThreadLocal;
 
 Vector<std::string>
@@ -26,6 +26,7 @@
 #include <CD_DomainFluxIFFABFactory.H>
 #include <CD_TiledMeshRefine.H>
 #include <CD_DataOps.H>
+#include <CD_LeastSquares.H>
 #include <CD_NamespaceHeader.H>
 
 AmrMesh::AmrMesh()
@@ -1109,6 +1110,9 @@ AmrMesh::regridOperators(const int a_lmin)
   }
 
   this->buildCopiers();
+
+  // The operators are built, so release the memory held by the least squares stencil cache.
+  LeastSquares::clearCache();
 }
 
 void
@@ -1240,7 +1244,12 @@ AmrMesh::buildGrids(const Vector<IntVectSet>& a_tags, const int a_lmin, const in
     }
 
     // Load balance this grid -- assign grid subsets to the least loaded rank.
-    LoadBalancing::makeBalance(processorIDs[lvl], rankLoads, boxLoads, newBoxes[lvl]);
+    if (m_sfcPartition) {
+      LoadBalancing::makeBalanceSFC(processorIDs[lvl], rankLoads, boxLoads, newBoxes[lvl]);
+    }
+    else {
+      LoadBalancing::makeBalance(processorIDs[lvl], rankLoads, boxLoads, newBoxes[lvl]);
+    }
   }
 
   // Now we define the grids. If a_lmin=0 every grid is new, otherwise keep old grids up to but not including a_lmin
@@ -2544,9 +2553,21 @@ AmrMesh::parseGridGeneration()
   else if (str == "morton") {
     m_boxSort = BoxSorting::Morton;
   }
+  else if (str == "hilbert") {
+    m_boxSort = BoxSorting::Hilbert;
+  }
   else {
     MayDay::Abort("AmrMesh::parseGridGeneration - unknown box sorting method requested");
   }
+
+  m_sfcPartition = false;
+  pp.query("sfc_partition", m_sfcPartition);
+
+  // The partition is only compact if the boxes are sorted along a space-filling curve.
+  if (m_sfcPartition && (m_boxSort == BoxSorting::None || m_boxSort == BoxSorting::Shuffle)) {
+    MayDay::Warning(
+      "AmrMesh::parseGridGeneration - 'sfc_partition = true' should be used with 'box_sorting = hilbert' or 'box_sorting = morton'");
+  }
 }
 
 void
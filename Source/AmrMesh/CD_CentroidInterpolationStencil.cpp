@@ -26,13 +26,14 @@ CentroidInterpolationStencil::CentroidInterpolationStencil(const DisjointBoxLayo
                                                            const Real&                     a_dx,
                                                            const int                       a_order,
                                                            const int                       a_radius,
-                                                           const IrregStencil::StencilType a_type)
+                                                           const IrregStencil::StencilType a_type,
+                                                           const IrregStencil*             a_previous)
   : IrregStencil()
 {
 
   CH_TIME("CentroidInterpolationStencil::CentroidInterpolationStencil");
 
-  this->define(a_dbl, a_ebisl, a_domain, a_dx, a_order, a_radius, a_type);
+  this->define(a_dbl, a_ebisl, a_domain, a_dx, a_order, a_radius, a_type, a_previous);
 }
 
 CentroidInterpolationStencil::~CentroidInterpolationStencil()
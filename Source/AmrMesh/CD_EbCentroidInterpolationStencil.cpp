@@ -24,12 +24,13 @@ EbCentroidInterpolationStencil::EbCentroidInterpolationStencil(const DisjointBox
                                                                const Real&                     a_dx,
                                                                const int                       a_order,
                                                                const int                       a_radius,
-                                                               const IrregStencil::StencilType a_type)
+                                                               const IrregStencil::StencilType a_type,
+                                                               const IrregStencil*             a_previous)
   : IrregStencil()
 {
   CH_TIME("EbCentroidInterpolationStencil::EbCentroidInterpolationStencil");
 
-  this->define(a_dbl, a_ebisl, a_domain, a_dx, a_order, a_radius, a_type);
+  this->define(a_dbl, a_ebisl, a_domain, a_dx, a_order, a_radius, a_type, a_previous);
 }
 
 EbCentroidInterpolationStencil::~EbCentroidInterpolationStencil()
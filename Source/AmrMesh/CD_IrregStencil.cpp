@@ -9,6 +9,9 @@
   @author Robert Marskar
 */
 
+// Std includes
+#include <map>
+
 // Chombo includes
 #include <NeighborIterator.H>
 
@@ -57,7 +60,8 @@ IrregStencil::define(const DisjointBoxLayout&        a_dbl,
                      const Real&                     a_dx,
                      const int                       a_order,
                      const int                       a_radius,
-                     const IrregStencil::StencilType a_type)
+                     const IrregStencil::StencilType a_type,
+                     const IrregStencil*             a_previous)
 {
   CH_TIME("IrregStencil::define");
 
@@ -70,6 +74,23 @@ IrregStencil::define(const DisjointBoxLayout&        a_dbl,
 
   m_stencils.define(m_dbl);
   m_vofIter.define(m_dbl);
+  m_cfivs.define(m_dbl);
+
+  // TLDR: If we have stencils from before a regrid, we can reuse the stencils in boxes that did not change. The stencils in a box only depend on the
+  //       box, the EB geometry, the level resolution and the coarse-fine interface around the box, so we can reuse them if the same box
+  //       exists in the old grids with the same coarse-fine interface, and the previous stencils were built with the same parameters. Only
+  //       boxes that are owned by this rank in both the old and new grids are considered. Boxes that migrated to a different rank are
+  //       recomputed. 
+  std::map<Box, DataIndex> previousBoxes;
+
+  const bool reusePrevious = (a_previous != nullptr) && (a_previous->m_dx == m_dx) && (a_previous->m_radius == m_radius) &&
+                             (a_previous->m_order == m_order) && (a_previous->m_stencilType == m_stencilType);
+
+  if (reusePrevious) {
+    for (DataIterator oldDit(a_previous->m_dbl); oldDit.ok(); ++oldDit) {
+      previousBoxes.emplace(a_previous->m_dbl[oldDit()], oldDit());
+    }
+  }
 
   const DataIterator& dit  = m_dbl.dataIterator();
   const int           nbox = dit.size();
@@ -90,11 +111,24 @@ IrregStencil::define(const DisjointBoxLayout&        a_dbl,
       cfivs -= m_dbl[nit()];
     }
 
-    m_stencils[din] = RefCountedPtr<BaseIVFAB<VoFStencil>>(new BaseIVFAB<VoFStencil>(ivs, ebgraph, m_defaultNumSten));
+    m_cfivs[din] = cfivs;
 
     VoFIterator& vofit = m_vofIter[din];
     vofit.define(ivs, ebgraph);
 
+    // Reuse stencils from the previous grids if we can. The stencils are not modified after they are built, so they can be shared.
+    const auto it = previousBoxes.find(box);
+
+    if (it != previousBoxes.end()) {
+      if (a_previous->m_cfivs[it->second] == cfivs) {
+        m_stencils[din] = a_previous->m_stencils[it->second];
+
+        continue;
+      }
+    }
+
+    m_stencils[din] = RefCountedPtr<BaseIVFAB<VoFStencil>>(new BaseIVFAB<VoFStencil>(ivs, ebgraph, m_defaultNumSten));
+
     auto kernel = [&](const VolIndex& vof) -> void {
       VoFStencil& stencil = (*m_stencils[din])(vof, 0);
       this->buildStencil(stencil, vof, m_dbl, m_domain, ebisbox, box, m_dx, cfivs);
@@ -9,8 +9,13 @@
   @author  Robert Marskar
 */
 
+// Std includes
+#include <algorithm>
+
 // Chombo includes
 #include <ParmParse.H>
+#include <LoHiSide.H>
+#include <NeighborIterator.H>
 
 // Our includes
 #include <CD_LoadBalancing.H>
@@ -27,6 +32,206 @@ LoadBalancing::sort(Vector<Box>& a_boxes, const BoxSorting a_which)
   LoadBalancing::sort(a_boxes, dummy, a_which);
 }
 
+void
+LoadBalancing::getCommunicationSurface(long long&               a_surface,
+                                       long long&               a_volume,
+                                       std::set<int>&           a_neighborRanks,
+                                       const DisjointBoxLayout& a_dbl) noexcept
+{
+  CH_TIME("LoadBalancing::getCommunicationSurface");
+
+  const int myRank = procID();
+
+  // TLDR: Only the neighbors of each box can share faces with it, so we use the neighbor lists in the DisjointBoxLayout rather than going
+  //       through all the boxes in the layout. This makes the cost proportional to the number of boxes on this rank.
+  for (DataIterator dit(a_dbl); dit.ok(); ++dit) {
+    const Box& box = a_dbl[dit()];
+
+    a_volume += box.numPts();
+
+    NeighborIterator nit(a_dbl);
+
+    for (nit.begin(dit()); nit.ok(); ++nit) {
+      const int neighborRank = a_dbl.procID(nit());
+
+      if (neighborRank != myRank) {
+        const Box neighborBox = nit.box();
+
+        // Go through the cell layers just outside each face of the box, and check if the neighbor overlaps with them.
+        for (int dir = 0; dir < SpaceDim; dir++) {
+          for (SideIterator sit; sit.ok(); ++sit) {
+            const Box faceLayer = adjCellBox(box, dir, sit(), 1);
+
+            if (faceLayer.intersectsNotEmpty(neighborBox)) {
+              a_surface += (faceLayer & neighborBox).numPts();
+
+              a_neighborRanks.insert(neighborRank);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+uint64_t
+LoadBalancing::hilbertIndex(const IntVect& a_point, const int a_bits) noexcept
+{
+  CH_assert(a_bits > 0 && a_bits * SpaceDim <= 64);
+
+  // TLDR: This is the algorithm from J. Skilling, "Programming the Hilbert curve", AIP Conference Proceedings 707 (2004). The coordinates are
+  //       first transformed (in place) into the "transposed" Hilbert index, in which bit b of the index is distributed across the coordinates.
+  //       We then interleave the bits, starting with the most significant bit.
+  uint32_t X[SpaceDim];
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    CH_assert(a_point[dir] >= 0);
+
+    X[dir] = (uint32_t)a_point[dir];
+  }
+
+  const uint32_t M = 1U << (a_bits - 1);
+
+  // Inverse undo excess work
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    const uint32_t P = Q - 1;
+
+    for (int i = 0; i < SpaceDim; i++) {
+      if (X[i] & Q) {
+        X[0] ^= P;
+      }
+      else {
+        const uint32_t t = (X[0] ^ X[i]) & P;
+
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (int i = 1; i < SpaceDim; i++) {
+    X[i] ^= X[i - 1];
+  }
+
+  uint32_t t = 0;
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    if (X[SpaceDim - 1] & Q) {
+      t ^= Q - 1;
+    }
+  }
+
+  for (int i = 0; i < SpaceDim; i++) {
+    X[i] ^= t;
+  }
+
+  // Interleave the bits.
+  uint64_t index = 0;
+  for (int b = a_bits - 1; b >= 0; b--) {
+    for (int i = 0; i < SpaceDim; i++) {
+      index = (index << 1) | ((X[i] >> b) & 1U);
+    }
+  }
+
+  return index;
+}
+
+bool
+LoadBalancing::rebalance(Vector<Vector<int>>&        a_ranks,
+                         const Vector<Vector<Real>>& a_boxCosts,
+                         const Vector<Vector<Real>>& a_migrationCosts,
+                         const Real                  a_horizon,
+                         const Real                  a_fixedCost) noexcept
+{
+  CH_TIME("LoadBalancing::rebalance");
+
+  CH_assert(a_boxCosts.size() == a_ranks.size());
+  CH_assert(a_migrationCosts.size() == a_ranks.size());
+
+  // TLDR: This is a greedy diffusion-type algorithm. In each iteration we find the most loaded rank (the one that determines the step time)
+  //       and the least loaded rank, and move the box from the most loaded to the least loaded rank which gives the largest net gain. The
+  //       gain of moving a box with cost c from rank p to q is the reduction in max(L_p, L_q) accumulated over the horizon, and the net gain
+  //       subtracts the migration cost of the box. We stop when no box gives a positive net gain.
+  const int numRanks  = numProc();
+  const int numLevels = a_ranks.size();
+
+  Vector<Vector<int>>  newRanks = a_ranks;
+  Vector<Vector<bool>> moved(numLevels);
+  std::vector<Real>    rankLoads(numRanks, 0.0);
+
+  int numBoxes = 0;
+  for (int lvl = 0; lvl < numLevels; lvl++) {
+    CH_assert(a_boxCosts[lvl].size() == a_ranks[lvl].size());
+    CH_assert(a_migrationCosts[lvl].size() == a_ranks[lvl].size());
+
+    moved[lvl].resize(a_ranks[lvl].size(), false);
+
+    for (int ibox = 0; ibox < a_ranks[lvl].size(); ibox++) {
+      rankLoads[a_ranks[lvl][ibox]] += a_boxCosts[lvl][ibox];
+    }
+
+    numBoxes += a_ranks[lvl].size();
+  }
+
+  const Real oldMaxLoad = *std::max_element(rankLoads.begin(), rankLoads.end());
+
+  Real migrationCost = 0.0;
+
+  for (int iter = 0; iter < numBoxes; iter++) {
+    const int p = std::max_element(rankLoads.begin(), rankLoads.end()) - rankLoads.begin();
+    const int q = std::min_element(rankLoads.begin(), rankLoads.end()) - rankLoads.begin();
+
+    if (p == q) {
+      break;
+    }
+
+    int  bestLevel = -1;
+    int  bestBox   = -1;
+    Real bestGain  = 0.0;
+
+    for (int lvl = 0; lvl < numLevels; lvl++) {
+      for (int ibox = 0; ibox < newRanks[lvl].size(); ibox++) {
+        if (newRanks[lvl][ibox] == p && !(moved[lvl][ibox])) {
+          const Real c = a_boxCosts[lvl][ibox];
+
+          const Real gain = (rankLoads[p] - std::max(rankLoads[p] - c, rankLoads[q] + c)) * a_horizon -
+                            a_migrationCosts[lvl][ibox];
+
+          if (gain > bestGain) {
+            bestLevel = lvl;
+            bestBox   = ibox;
+            bestGain  = gain;
+          }
+        }
+      }
+    }
+
+    if (bestLevel < 0) {
+      break;
+    }
+
+    newRanks[bestLevel][bestBox] = q;
+    moved[bestLevel][bestBox]    = true;
+
+    rankLoads[p] -= a_boxCosts[bestLevel][bestBox];
+    rankLoads[q] += a_boxCosts[bestLevel][bestBox];
+
+    migrationCost += a_migrationCosts[bestLevel][bestBox];
+  }
+
+  const Real newMaxLoad = *std::max_element(rankLoads.begin(), rankLoads.end());
+
+  // Only accept the new assignment if it pays off.
+  bool changed = false;
+
+  if ((oldMaxLoad - newMaxLoad) * a_horizon > migrationCost + a_fixedCost) {
+    a_ranks = newRanks;
+
+    changed = true;
+  }
+
+  return changed;
+}
+
 void
 LoadBalancing::gatherBoxes(Vector<Box>& a_boxes)
 {
@@ -23,14 +23,15 @@ NonConservativeDivergenceStencil::NonConservativeDivergenceStencil(const Disjoin
                                                                    const Real&                     a_dx,
                                                                    const int                       a_order,
                                                                    const int                       a_radius,
-                                                                   const IrregStencil::StencilType a_type)
+                                                                   const IrregStencil::StencilType a_type,
+                                                                   const IrregStencil*             a_previous)
   : IrregStencil()
 {
 
   CH_TIME("NonConservativeDivergenceStencil::NonConservativeDivergenceStencil");
 
   // Order and radius are dummy arguments.
-  this->define(a_dbl, a_ebisl, a_domain, a_dx, a_order, a_radius, IrregStencil::StencilType::Linear);
+  this->define(a_dbl, a_ebisl, a_domain, a_dx, a_order, a_radius, IrregStencil::StencilType::Linear, a_previous);
 }
 
 NonConservativeDivergenceStencil::~NonConservativeDivergenceStencil()
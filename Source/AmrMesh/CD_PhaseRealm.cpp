@@ -9,6 +9,9 @@
   @author Robert Marskar
 */
 
+// Std includes
+#include <map>
+
 // Chombo includes
 #include <EBArith.H>
 #include <ParmParse.H>
@@ -30,9 +33,10 @@ PhaseRealm::PhaseRealm()
   CH_TIME("PhaseRealm::PhaseRealm");
 
   // Default settings
-  m_isDefined = false;
-  m_profile   = false;
-  m_verbose   = false;
+  m_isDefined      = false;
+  m_profile        = false;
+  m_verbose        = false;
+  m_reuseOperators = true;
 
   this->registerOperator(s_eb_gradient);
   this->registerOperator(s_eb_irreg_interp);
@@ -41,6 +45,7 @@ PhaseRealm::PhaseRealm()
   ParmParse pp("PhaseRealm");
   pp.query("profile", m_profile);
   pp.query("verbosity", m_verbose);
+  pp.query("reuse_operators", m_reuseOperators);
 }
 
 PhaseRealm::~PhaseRealm()
@@ -95,6 +100,7 @@ PhaseRealm::define(const Vector<DisjointBoxLayout>&   a_grids,
   ParmParse pp("PhaseRealm");
   pp.query("profile", m_profile);
   pp.query("verbosity", m_verbose);
+  pp.query("reuse_operators", m_reuseOperators);
 }
 
 void
@@ -119,6 +125,14 @@ PhaseRealm::preRegrid()
     pout() << "PhaseRealm::preRegrid" << endl;
   }
 
+  // Hang on to the cut-cell stencils and level-set data so that they can be reused in boxes that do not change.
+  if (m_reuseOperators) {
+    m_previousLevelset                         = m_levelset;
+    m_previousCentroidInterpolationStencil     = m_centroidInterpolationStencil;
+    m_previousEbCentroidInterpolationStencil   = m_ebCentroidInterpolationStencil;
+    m_previousNonConservativeDivergenceStencil = m_NonConservativeDivergenceStencil;
+  }
+
   m_grids.resize(0);
   m_ebisl.resize(0);
   m_eblg.resize(0);
@@ -486,6 +500,20 @@ PhaseRealm::defineLevelSet(const int a_lmin, const int a_numGhost)
       m_levelset[lvl] = RefCountedPtr<LevelData<FArrayBox>>(
         new LevelData<FArrayBox>(dbl, ncomp, a_numGhost * IntVect::Unit));
 
+      // TLDR: The level-set function is evaluated on every cell (including ghost cells), which can be expensive for complex geometries. If
+      //       the same box existed on this rank before the regrid we just copy the old data rather than evaluating the implicit function again.
+      std::map<Box, DataIndex> previousBoxes;
+
+      const bool hasPrevious = lvl < static_cast<int>(m_previousLevelset.size()) && !(m_previousLevelset[lvl].isNull());
+
+      if (hasPrevious) {
+        const DisjointBoxLayout& oldGrids = m_previousLevelset[lvl]->disjointBoxLayout();
+
+        for (DataIterator oldDit(oldGrids); oldDit.ok(); ++oldDit) {
+          previousBoxes.emplace(oldGrids[oldDit()], oldDit());
+        }
+      }
+
       const int nbox = dit.size();
 #pragma omp parallel for schedule(runtime)
       for (int mybox = 0; mybox < nbox; mybox++) {
@@ -494,6 +522,18 @@ PhaseRealm::defineLevelSet(const int a_lmin, const int a_numGhost)
         FArrayBox& fab = (*m_levelset[lvl])[din];
         const Box  bx  = fab.box();
 
+        const auto it = previousBoxes.find(dbl[din]);
+
+        if (it != previousBoxes.end()) {
+          const FArrayBox& oldFab = (*m_previousLevelset[lvl])[it->second];
+
+          if (oldFab.box() == bx) {
+            fab.copy(oldFab, bx, comp, bx, comp, ncomp);
+
+            continue;
+          }
+        }
+
         if (!m_baseif.isNull()) {
           auto kernel = [&](const IntVect& iv) -> void {
             const RealVect pos = m_probLo + (0.5 * RealVect::Unit + RealVect(iv)) * dx;
@@ -509,6 +549,8 @@ PhaseRealm::defineLevelSet(const int a_lmin, const int a_numGhost)
       }
     }
   }
+
+  m_previousLevelset.clear();
 }
 
 void
@@ -819,7 +861,10 @@ PhaseRealm::defineIrregSten()
                                                         m_finestLevel,
                                                         order,
                                                         rad,
-                                                        m_centroidStencilType));
+                                                        m_centroidStencilType,
+                                                        m_previousCentroidInterpolationStencil.isNull()
+                                                          ? nullptr
+                                                          : &(*m_previousCentroidInterpolationStencil)));
 
     m_ebCentroidInterpolationStencil = RefCountedPtr<IrregAmrStencil<EbCentroidInterpolationStencil>>(
       new IrregAmrStencil<EbCentroidInterpolationStencil>(m_grids,
@@ -829,8 +874,15 @@ PhaseRealm::defineIrregSten()
                                                           m_finestLevel,
                                                           order,
                                                           rad,
-                                                          m_ebCentroidStencilType));
+                                                          m_ebCentroidStencilType,
+                                                          m_previousEbCentroidInterpolationStencil.isNull()
+                                                            ? nullptr
+                                                            : &(*m_previousEbCentroidInterpolationStencil)));
   }
+
+  // Release the old stencils. Stencils that were reused are still held by the new objects.
+  m_previousCentroidInterpolationStencil   = RefCountedPtr<IrregAmrStencil<CentroidInterpolationStencil>>(0);
+  m_previousEbCentroidInterpolationStencil = RefCountedPtr<IrregAmrStencil<EbCentroidInterpolationStencil>>(0);
 }
 
 void
@@ -855,8 +907,12 @@ PhaseRealm::defineNonConsDivSten()
         m_finestLevel,
         order, // Dummy argument
         m_redistributionRadius,
-        m_centroidStencilType)); // Dummy argument, just use centroidStencilType.
+        m_centroidStencilType, // Dummy argument, just use centroidStencilType.
+        m_previousNonConservativeDivergenceStencil.isNull() ? nullptr : &(*m_previousNonConservativeDivergenceStencil)));
   }
+
+  // Release the old stencils. Stencils that were reused are still held by the new objects.
+  m_previousNonConservativeDivergenceStencil = RefCountedPtr<IrregAmrStencil<NonConservativeDivergenceStencil>>(0);
 }
 
 const RefCountedPtr<EBIndexSpace>&
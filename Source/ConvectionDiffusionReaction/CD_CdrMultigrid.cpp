@@ -234,6 +234,11 @@ CdrMultigrid::advanceEuler(EBAMRCellData&       a_newPhi,
 
     // Do the multigrid solve.
     m_multigridSolver->solveNoInitResid(newPhi, resid, eulerRHS, finestLevel, coarsestLevel, false);
+
+    // 1 => Initial norm sufficiently reduced, 8 => Norm sufficiently small. A zero right-hand side is trivially converged.
+    const int status = m_multigridSolver->m_exitStatus;
+
+    m_diffusionConverged = (status == 1 || status == 8 || zeroResid == 0.0);
   }
   else {
     DataOps::copy(a_newPhi, a_oldPhi);
@@ -333,6 +338,11 @@ CdrMultigrid::advanceCrankNicholson(EBAMRCellData&       a_newPhi,
 
     // Do the multigrid solve.
     m_multigridSolver->solveNoInitResid(newPhi, resid, eulerRHS, finestLevel, coarsestLevel, false);
+
+    // 1 => Initial norm sufficiently reduced, 8 => Norm sufficiently small. A zero right-hand side is trivially converged.
+    const int status = m_multigridSolver->m_exitStatus;
+
+    m_diffusionConverged = (status == 1 || status == 8 || zeroResid == 0.0);
   }
   else {
     DataOps::copy(a_newPhi, a_oldPhi);
@@ -740,6 +750,9 @@ CdrMultigrid::parseMultigridSettings()
   else if (str == "multi_color") {
     m_smoother = EBHelmholtzOp::Smoother::GauSaiMultiColor;
   }
+  else if (str == "red_black_deep") {
+    m_smoother = EBHelmholtzOp::Smoother::GauSaiRedBlackDeep;
+  }
   else {
     MayDay::Error("CdrMultigrid::parseMultigridSettings - unknown relaxation method requested");
   }
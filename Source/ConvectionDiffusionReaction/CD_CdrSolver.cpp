@@ -30,10 +30,11 @@ CdrSolver::CdrSolver()
 {
 
   // Default options.
-  m_verbosity    = -1;
-  m_name         = "CdrSolver";
-  m_className    = "CdrSolver";
-  m_regridSlopes = true;
+  m_verbosity          = -1;
+  m_name               = "CdrSolver";
+  m_className          = "CdrSolver";
+  m_regridSlopes       = true;
+  m_diffusionConverged = true;
 
   this->setRealm(Realm::Primal);
   this->setDefaultDomainBC(); // Set default domain BCs (wall)
@@ -2586,6 +2587,17 @@ CdrSolver::isDiffusive()
   return m_isDiffusive;
 }
 
+bool
+CdrSolver::isDiffusionConverged() const noexcept
+{
+  CH_TIME("CdrSolver::isDiffusionConverged()");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::isDiffusionConverged()" << endl;
+  }
+
+  return m_diffusionConverged;
+}
+
 bool
 CdrSolver::isMobile()
 {
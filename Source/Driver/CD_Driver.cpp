@@ -10,8 +10,11 @@
 */
 
 // Std includes
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <set>
 #include <sstream>
 
 // Chombo includes
@@ -37,6 +40,7 @@
 #include <CD_ParallelOps.H>
 #include <CD_DischargeIO.H>
 #include <CD_OpenMP.H>
+#include <CD_LeastSquares.H>
 #include <CD_NamespaceHeader.H>
 
 Driver::Driver(const RefCountedPtr<ComputationalGeometry>& a_computationalGeometry,
@@ -68,6 +72,16 @@ Driver::Driver(const RefCountedPtr<ComputationalGeometry>& a_computationalGeomet
 
   m_profile      = false;
   m_doCoarsening = true;
+  m_asyncPlot    = false;
+
+  m_asyncPlotMaxMemory = 2048.0;
+
+  // Dynamic rebalancing is turned off by default.
+  m_rebalanceInterval      = -1;
+  m_rebalanceMigrationCost = 1.0;
+  m_advanceSteps           = 0;
+  m_advanceTime            = 0.0;
+  m_lastRegridTime         = 0.0;
 
   // Parse some class options and create the output directories for the simulation.
   this->parseOptions();
@@ -84,6 +98,8 @@ Driver::Driver(const RefCountedPtr<ComputationalGeometry>& a_computationalGeomet
 Driver::~Driver()
 {
   CH_TIME("Driver::~Driver()");
+
+  this->waitForPlotFile();
 }
 
 int
@@ -557,13 +573,48 @@ Driver::gridReport()
                            finestLevel,
                            m_amr->getGrids(str));
 
+    // Communication surface-to-volume ratio and number of neighboring ranks. These are measures of the locality of the domain decomposition.
+    long long     surface = 0LL;
+    long long     volume  = 0LL;
+    std::set<int> neighborRanks;
+
+    for (int lvl = 0; lvl <= finestLevel; lvl++) {
+      const DisjointBoxLayout& dbl = m_amr->getGrids(str)[lvl];
+
+      LoadBalancing::getCommunicationSurface(surface, volume, neighborRanks, dbl);
+    }
+
+    const Real surfaceToVolume = (volume > 0LL) ? (1.0 * surface) / volume : 0.0;
+    const int  numNeighbors    = neighborRanks.size();
+
     pout() << "\t**************" << endl
            << "\tRealm = " << str << endl
            << "\t...Proc. # of valid cells... = " << DischargeIO::numberFmt(localCells) << endl
            << "\t...Including ghost cells.... = " << DischargeIO::numberFmt(localCellsGhosts) << endl
            << "\t...Proc. # of boxes......... = " << DischargeIO::numberFmt(localBoxes) << endl
            << "\t...Proc. # of boxes (lvl)... = " << DischargeIO::numberFmt(localLevelBoxes) << endl
-           << "\t...Proc. # of cells (lvl)... = " << DischargeIO::numberFmt(localLevelCells) << endl;
+           << "\t...Proc. # of cells (lvl)... = " << DischargeIO::numberFmt(localLevelCells) << endl
+           << "\t...Proc. surface/volume..... = " << surfaceToVolume << endl
+           << "\t...Max. surface/volume...... = " << ParallelOps::max(surfaceToVolume) << endl
+           << "\t...Proc. # of neighbors..... = " << numNeighbors << endl
+           << "\t...Max. # of neighbors...... = " << ParallelOps::max(numNeighbors) << endl;
+  }
+
+  // Report how many of the least squares systems (used for the cut-cell stencils) were found in the stencil cache.
+  long long cacheHits    = 0LL;
+  long long cacheLookups = 0LL;
+
+  LeastSquares::getCacheStatistics(cacheHits, cacheLookups);
+
+  const long long totalCacheHits    = ParallelOps::sum(cacheHits);
+  const long long totalCacheLookups = ParallelOps::sum(cacheLookups);
+
+  if (totalCacheLookups > 0LL) {
+    pout() << "\t**************" << endl
+           << "\tLeast squares stencil cache" << endl
+           << "\t...Lookups................. = " << DischargeIO::numberFmt(totalCacheLookups) << endl
+           << "\t...Hits.................... = " << DischargeIO::numberFmt(totalCacheHits) << endl
+           << "\t...Hit rate................ = " << (100.0 * totalCacheHits) / totalCacheLookups << "%" << endl;
   }
 
   // Write a memory report if Chombo was to compiled to use memory tracking.
@@ -609,6 +660,8 @@ Driver::regrid(const int a_lmin, const int a_lmax, const bool a_useInitialData)
   // Use a timer here because I want to be able to put some diagnostics into this function.
   Timer timer("Driver::regrid(int, int, bool)");
 
+  const Real startTime = Timer::wallClock();
+
   // We are allowing geometric tags to change under the hood, but we need a method for detecting if they changed. If they did,
   // we certainly have to regrid.
   timer.startEvent("Get geometry tags");
@@ -703,11 +756,146 @@ Driver::regrid(const int a_lmin, const int a_lmax, const bool a_useInitialData)
 
   m_needsNewGeometricTags = false;
 
+  // Store the regrid time and restart the step time measurement. These are used for rebalancing between regrids.
+  m_lastRegridTime = ParallelOps::max(Timer::wallClock() - startTime);
+  m_advanceTime    = 0.0;
+  m_advanceSteps   = 0;
+
   if (m_profile) {
     timer.eventReport(pout(), true);
   }
 }
 
+void
+Driver::rebalance()
+{
+  CH_TIME("Driver::rebalance()");
+  if (m_verbosity > 2) {
+    pout() << "Driver::rebalance()" << endl;
+  }
+
+  // TLDR: This routine reassigns the grid patches to MPI ranks without changing the grids. We use the measured time per step together with the
+  //       loads from the TimeStepper (e.g., the number of computational particles in each patch) to estimate the cost of each patch, and let
+  //       LoadBalancing::rebalance figure out which patches (if any) are worth moving. If nothing is moved we return without touching the
+  //       solvers. Otherwise we go through the same steps as in a regrid, where the realms are redefined with the new processor IDs.
+
+  if (m_advanceSteps <= 0) {
+    return;
+  }
+
+  const Real startTime   = Timer::wallClock();
+  const int  finestLevel = m_amr->getFinestLevel();
+  const int  numRanks    = numProc();
+
+  // Measured wall-clock time per step. This is determined by the most loaded rank, and we use it to convert the loads to time.
+  const Real stepTime = ParallelOps::max(m_advanceTime) / m_advanceSteps;
+
+  // Number of steps that the new distribution will be used for, i.e., until the next regrid.
+  int horizon = m_rebalanceInterval;
+  if (m_regridInterval > 0 && m_amr->getMaxAmrDepth() > 0) {
+    horizon = m_regridInterval - m_timeStep % m_regridInterval;
+  }
+
+  m_advanceTime  = 0.0;
+  m_advanceSteps = 0;
+
+  std::map<std::string, Vector<Vector<int>>> newProcs;
+
+  for (const auto& str : m_amr->getRealms()) {
+    if (m_timeStepper->loadBalanceThisRealm(str)) {
+      const Vector<DisjointBoxLayout>& grids = m_amr->getGrids(str);
+
+      Vector<Vector<int>>  procs(1 + finestLevel);
+      Vector<Vector<Real>> boxCosts(1 + finestLevel);
+      Vector<Vector<Real>> migrationCosts(1 + finestLevel);
+
+      std::vector<Real> rankLoads(numRanks, 0.0);
+
+      for (int lvl = 0; lvl <= finestLevel; lvl++) {
+        const Vector<long int> loads = m_timeStepper->getCheckpointLoads(str, lvl);
+
+        procs[lvl] = grids[lvl].procIDs();
+
+        boxCosts[lvl].resize(loads.size());
+        migrationCosts[lvl].resize(loads.size());
+
+        for (int ibox = 0; ibox < loads.size(); ibox++) {
+          boxCosts[lvl][ibox] = 1.0 * loads[ibox];
+
+          rankLoads[procs[lvl][ibox]] += boxCosts[lvl][ibox];
+        }
+      }
+
+      const Real maxRankLoad = *std::max_element(rankLoads.begin(), rankLoads.end());
+
+      if (maxRankLoad > 0.0) {
+        const Real timePerLoad = stepTime / maxRankLoad;
+
+        for (int lvl = 0; lvl <= finestLevel; lvl++) {
+          for (int ibox = 0; ibox < boxCosts[lvl].size(); ibox++) {
+            boxCosts[lvl][ibox] *= timePerLoad;
+
+            migrationCosts[lvl][ibox] = m_rebalanceMigrationCost * boxCosts[lvl][ibox];
+          }
+        }
+
+        if (LoadBalancing::rebalance(procs, boxCosts, migrationCosts, 1.0 * horizon, m_lastRegridTime)) {
+          newProcs.emplace(str, procs);
+        }
+      }
+    }
+  }
+
+  if (newProcs.size() > 0) {
+    if (m_verbosity > 1) {
+      pout() << "Driver::rebalance -- moving grid patches for " << newProcs.size() << " realm(s)" << endl;
+    }
+
+    // Boxes do not change. AmrMesh::preRegrid clears the grids of every realm, so every realm must be redefined below. Realms that were not
+    // rebalanced keep their current processor IDs.
+    std::map<std::string, Vector<Vector<Box>>> boxes;
+    std::map<std::string, Vector<Vector<int>>> procs;
+    for (const auto& str : m_amr->getRealms()) {
+      Vector<Vector<Box>>& realmBoxes = boxes[str];
+      Vector<Vector<int>>& realmProcs = procs[str];
+
+      realmBoxes.resize(1 + finestLevel);
+      realmProcs.resize(1 + finestLevel);
+      for (int lvl = 0; lvl <= finestLevel; lvl++) {
+        realmBoxes[lvl] = m_amr->getGrids(str)[lvl].boxArray();
+        realmProcs[lvl] = m_amr->getGrids(str)[lvl].procIDs();
+      }
+    }
+
+    for (const auto& p : newProcs) {
+      procs[p.first] = p.second;
+    }
+
+    this->cacheTags(m_tags);
+    m_timeStepper->preRegrid(0, finestLevel);
+    if (!(m_cellTagger.isNull())) {
+      m_cellTagger->preRegrid();
+    }
+    m_amr->preRegrid();
+
+    for (const auto& p : procs) {
+      m_amr->regridRealm(p.first, p.second, boxes.at(p.first), 0);
+    }
+
+    m_amr->regridOperators(0);
+    m_amr->postRegrid();
+
+    this->regridInternals(finestLevel, finestLevel);
+    m_timeStepper->regrid(0, finestLevel, finestLevel);
+    if (!m_cellTagger.isNull()) {
+      m_cellTagger->regrid();
+    }
+    m_timeStepper->postRegrid();
+
+    m_lastRegridTime = ParallelOps::max(Timer::wallClock() - startTime);
+  }
+}
+
 void
 Driver::regridInternals(const int a_oldFinestLevel, const int a_newFinestLevel)
 {
@@ -839,6 +1027,9 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
           }
         }
       }
+      else if (m_rebalanceInterval > 0 && m_timeStep % m_rebalanceInterval == 0 && !isFirstStep) {
+        this->rebalance();
+      }
 
       // Compute a time step for the TimeStepper::advance(...) method.
       if (!isFirstStep) {
@@ -905,6 +1096,10 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
       const Real actualDt = m_timeStepper->advance(m_dt);
       m_wallClockTwo      = Timer::wallClock();
 
+      // Accumulate the time spent in advance. This is used for rebalancing between regrids.
+      m_advanceTime += m_wallClockTwo - m_wallClockOne;
+      m_advanceSteps += 1;
+
       // Synchronize times
       m_dt = actualDt;
       m_time += actualDt;
@@ -950,7 +1145,18 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
           this->writePlotFile();
         }
       }
+#endif
+
+      // In-situ extraction of probes, line-outs, and slices.
+      if (m_fieldExtraction.isExtractionStep(m_timeStep)) {
+        if (m_verbosity > 2) {
+          pout() << "Driver::run -- Extracting fields" << endl;
+        }
+
+        this->extractFields();
+      }
 
+#ifdef CH_USE_HDF5
       // Write checkpoint file
       if (m_checkpointInterval > 0) {
         if (m_timeStep % m_checkpointInterval == 0 || isLastStep == true) {
@@ -981,6 +1187,9 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
 
     MemoryReport::getMaxMinMemoryUsage();
   }
+
+  // Make sure the last plot file is written before we leave.
+  this->waitForPlotFile();
 }
 
 void
@@ -1117,6 +1326,13 @@ Driver::parseOptions()
 
   // Not a required thing.
   pp.query("coarsening", m_doCoarsening);
+  pp.query("rebalance_interval", m_rebalanceInterval);
+  pp.query("rebalance_migration_cost", m_rebalanceMigrationCost);
+
+  this->parseAsyncPlot();
+  this->parsePlotPrecision();
+
+  m_fieldExtraction.parseOptions();
 }
 
 void
@@ -1143,12 +1359,125 @@ Driver::parseRuntimeOptions()
   pp.get("max_steps", m_maxSteps);
   pp.get("stop_time", m_stopTime);
   pp.get("output_dt", m_outputDt);
+  pp.query("rebalance_interval", m_rebalanceInterval);
+  pp.query("rebalance_migration_cost", m_rebalanceMigrationCost);
+
+  this->parseAsyncPlot();
+  this->parsePlotPrecision();
+
+  m_fieldExtraction.parseRuntimeOptions();
 
   this->parseGeometryRefinement();
   this->parsePlotVariables();
   this->parseIrregTagGrowth();
 }
 
+void
+Driver::parseAsyncPlot()
+{
+  CH_TIME("Driver::parseAsyncPlot()");
+  if (m_verbosity > 5) {
+    pout() << "Driver::parseAsyncPlot()" << endl;
+  }
+
+  // TLDR: The plot file is written by a separate thread while the main thread continues with the time stepping. Chombo's
+  //       parallel HDF5 writes are collective on the global MPI communicator, and MPI does not permit collectives from two
+  //       threads on the same communicator. We therefore gather the plot data onto rank 0 on the main thread, and rank 0 then
+  //       writes the file with serial HDF5 on the I/O thread. The I/O thread does not do any MPI calls, so this works with
+  //       any MPI thread support level.
+  ParmParse pp("Driver");
+
+  m_asyncPlot          = false;
+  m_asyncPlotMaxMemory = 2048.0;
+
+  pp.query("async_plot", m_asyncPlot);
+  pp.query("async_plot_max_memory", m_asyncPlotMaxMemory);
+}
+
+void
+Driver::parsePlotPrecision()
+{
+  CH_TIME("Driver::parsePlotPrecision()");
+  if (m_verbosity > 5) {
+    pout() << "Driver::parsePlotPrecision()" << endl;
+  }
+
+  ParmParse pp("Driver");
+
+  auto getPrecision = [](const std::string& a_str) -> DischargeIO::Precision {
+    DischargeIO::Precision precision = DischargeIO::Precision::Double;
+
+    if (a_str == "double") {
+      precision = DischargeIO::Precision::Double;
+    }
+    else if (a_str == "float") {
+      precision = DischargeIO::Precision::Single;
+    }
+    else if (a_str == "half") {
+      precision = DischargeIO::Precision::Half;
+    }
+    else {
+      MayDay::Error("Driver::parsePlotPrecision - precision must be 'double', 'float', or 'half'");
+    }
+
+    return precision;
+  };
+
+  std::string str;
+
+  m_plotOptions = DischargeIO::PlotOptions();
+
+  // Storage precision
+  str = "double";
+  pp.query("plot_precision", str);
+  m_plotOptions.m_precision = getPrecision(str);
+
+  // Per-variable precision. This is given as pairs of variable names and precisions.
+  m_plotVariablePrecision.clear();
+
+  const int num = pp.countval("plot_variable_precision");
+  if (num % 2 != 0) {
+    MayDay::Error("Driver::parsePlotPrecision - 'plot_variable_precision' must be given as pairs of names and precisions");
+  }
+  for (int i = 0; i < num; i += 2) {
+    std::string name;
+    std::string precision;
+
+    pp.get("plot_variable_precision", name, i);
+    pp.get("plot_variable_precision", precision, i + 1);
+
+    m_plotVariablePrecision[name] = getPrecision(precision);
+  }
+
+  // Compression
+  str = "none";
+  pp.query("plot_compression", str);
+  if (str == "none") {
+    m_plotOptions.m_compression = DischargeIO::Compression::None;
+  }
+  else if (str == "deflate") {
+    m_plotOptions.m_compression = DischargeIO::Compression::Deflate;
+  }
+  else if (str == "shuffle_deflate") {
+    m_plotOptions.m_compression = DischargeIO::Compression::ShuffleDeflate;
+  }
+  else {
+    MayDay::Error("Driver::parsePlotPrecision - 'plot_compression' must be 'none', 'deflate', or 'shuffle_deflate'");
+  }
+
+  pp.query("plot_compression_level", m_plotOptions.m_compressionLevel);
+  pp.query("plot_chunk_size", m_plotOptions.m_chunkSize);
+  pp.query("plot_abs_error", m_plotOptions.m_absoluteError);
+  pp.query("plot_rel_error", m_plotOptions.m_relativeError);
+
+  if (m_plotOptions.m_compressionLevel < 0 || m_plotOptions.m_compressionLevel > 9) {
+    MayDay::Error("Driver::parsePlotPrecision - 'plot_compression_level' must be between 0 and 9");
+  }
+  if (m_plotOptions.m_chunkSize <= 0) {
+    MayDay::Error("Driver::parsePlotPrecision - 'plot_chunk_size' must be > 0");
+  }
+}
+
 void
 Driver::parsePlotVariables()
 {
@@ -1333,6 +1662,12 @@ Driver::createOutputDirectories()
     if (success != 0) {
       std::cout << "Driver::createOutputDirectories - master could not create crash directory" << std::endl;
     }
+
+    cmd     = "mkdir -p " + m_outputDirectory + "/extraction";
+    success = system(cmd.c_str());
+    if (success != 0) {
+      std::cout << "Driver::createOutputDirectories - master could not create extraction directory" << std::endl;
+    }
   }
 
   ParallelOps::barrier();
@@ -1373,6 +1708,9 @@ Driver::setup(const std::string a_inputFile,
     this->setupGeometryOnly();
   }
   else {
+    // Set up in-situ extraction. When restarting we append to the existing extraction files.
+    m_fieldExtraction.define(m_amr, m_realm, m_outputDirectory + "/extraction/" + m_outputFileNames, a_restart);
+
     if (!a_restart) {
       this->setupFresh(a_initialRegrids);
 #ifdef CH_USE_HDF5
@@ -1387,6 +1725,10 @@ Driver::setup(const std::string a_inputFile,
         this->writePlotFile();
       }
 #endif
+
+      if (m_fieldExtraction.isExtractionStep(m_timeStep)) {
+        this->extractFields();
+      }
     }
     else {
 #ifdef CH_USE_HDF5
@@ -2240,6 +2582,12 @@ Driver::writePlotFile(const std::string a_filename)
     pout() << "Driver::writePlotFile(string)" << endl;
   }
 
+  // There is at most one outstanding plot file, so finish the previous one (if any) before we start on this one.
+  this->waitForPlotFile();
+
+  // Whether or not this plot file is written asynchronously.
+  bool asyncPlot = false;
+
   // Time stepper does pre-plot operations
   m_timeStepper->prePlot();
   if (!(m_cellTagger.isNull())) {
@@ -2267,11 +2615,54 @@ Driver::writePlotFile(const std::string a_filename)
     }
     plotVariableNames.append(this->getPlotVariableNames());
 
-    // Write HDF5 header.
+    // Precision for each plot variable. Variables that were not specified use the storage precision.
+    DischargeIO::PlotOptions plotOptions = m_plotOptions;
+
+    plotOptions.m_variablePrecision.resize(plotVariableNames.size(), plotOptions.m_precision);
+    for (int i = 0; i < plotVariableNames.size(); i++) {
+      const auto it = m_plotVariablePrecision.find(plotVariableNames[i]);
+
+      if (it != m_plotVariablePrecision.end()) {
+        plotOptions.m_variablePrecision[i] = it->second;
+      }
+    }
+
+    // Rank 0 holds the full snapshot until the I/O thread is done. If that would exceed the user-specified memory cap, this
+    // plot file is written synchronously (in parallel) instead.
+    asyncPlot = m_asyncPlot;
+    if (asyncPlot && m_asyncPlotMaxMemory >= 0.0) {
+      const Real snapshotMemory = this->getPlotSnapshotMemory(maxPlotLevel, plotVariableNames.size());
+
+      if (snapshotMemory > m_asyncPlotMaxMemory) {
+        asyncPlot = false;
+
+        const std::string msg = "Driver::writePlotFile - plot snapshot requires " + std::to_string(snapshotMemory) +
+                                " MB on rank 0 (Driver.async_plot_max_memory = " +
+                                std::to_string(m_asyncPlotMaxMemory) + " MB). Writing '" + a_filename +
+                                "' synchronously";
+
+        pout() << msg << endl;
+        MayDay::Warning(msg.c_str());
+      }
+    }
+
+    // Write HDF5 header. If we write asynchronously we instead set up the snapshot, and the I/O thread writes the header.
 #ifdef CH_USE_HDF5
-    HDF5Handle handle(a_filename.c_str(), HDF5Handle::CREATE);
-    DischargeIO::writeEBHDF5Header(handle, numPlotLevels, m_amr->getProbLo(), plotVariableNames);
-    handle.close();
+    if (asyncPlot) {
+      m_plotSnapshot = std::unique_ptr<PlotSnapshot>(new PlotSnapshot());
+
+      m_plotSnapshot->filename      = a_filename;
+      m_plotSnapshot->variableNames = plotVariableNames;
+      m_plotSnapshot->dt            = m_dt;
+      m_plotSnapshot->time          = m_time;
+      m_plotSnapshot->numGhost      = m_numPlotGhost;
+      m_plotSnapshot->options       = plotOptions;
+    }
+    else {
+      HDF5Handle handle(a_filename.c_str(), HDF5Handle::CREATE);
+      DischargeIO::writeEBHDF5Header(handle, numPlotLevels, m_amr->getProbLo(), plotVariableNames);
+      handle.close();
+    }
 #endif
 
     Timer timer("Driver::writePlotFile");
@@ -2302,20 +2693,39 @@ Driver::writePlotFile(const std::string a_filename)
         MemoryReport::getMaxMinMemoryUsage();
       }
 
-      timer.startEvent("HDF5 write");
-      HDF5Handle handle(a_filename.c_str(), HDF5Handle::OPEN_RDWR);
-      const int  refRat = (lvl < m_amr->getFinestLevel()) ? m_amr->getRefinementRatios()[lvl] : 1;
-      DischargeIO::writeEBHDF5Level(handle,
-                                    outputData,
-                                    m_amr->getDomains()[lvl],
-                                    m_amr->getDx()[lvl],
-                                    m_dt,
-                                    m_time,
-                                    lvl,
-                                    refRat,
-                                    m_numPlotGhost);
-      handle.close();
-      timer.stopEvent("HDF5 write");
+      const int refRat = (lvl < m_amr->getFinestLevel()) ? m_amr->getRefinementRatios()[lvl] : 1;
+
+      if (asyncPlot) {
+        timer.startEvent("Snapshot");
+        LevelData<FArrayBox> levelData;
+        DischargeIO::makeEBHDF5LevelData(levelData, outputData, m_amr->getDomains()[lvl], m_amr->getDx()[lvl], m_numPlotGhost);
+
+        m_plotSnapshot->levels.emplace_back();
+
+        DischargeIO::gatherEBHDF5LevelData(m_plotSnapshot->levels.back(),
+                                           levelData,
+                                           m_amr->getDomains()[lvl],
+                                           m_amr->getDx()[lvl],
+                                           refRat,
+                                           m_numPlotGhost);
+        timer.stopEvent("Snapshot");
+      }
+      else {
+        timer.startEvent("HDF5 write");
+        HDF5Handle handle(a_filename.c_str(), HDF5Handle::OPEN_RDWR);
+        DischargeIO::writeEBHDF5Level(handle,
+                                      outputData,
+                                      m_amr->getDomains()[lvl],
+                                      m_amr->getDx()[lvl],
+                                      m_dt,
+                                      m_time,
+                                      lvl,
+                                      refRat,
+                                      m_numPlotGhost,
+                                      plotOptions);
+        handle.close();
+        timer.stopEvent("HDF5 write");
+      }
 
       if (m_verbosity > 2) {
         MemoryReport::getMaxMinMemoryUsage();
@@ -2334,8 +2744,174 @@ Driver::writePlotFile(const std::string a_filename)
     pout() << msg1 << a_filename.c_str() << msg2 << endl;
   }
 
-  // TimeStepper does post-plot operations.
+  // TimeStepper does post-plot operations. This must happen before the I/O thread starts because postPlot can do HDF5 output
+  // of its own (e.g. particle files), and the HDF5 library must not be called from two threads at the same time.
   m_timeStepper->postPlot();
+
+#ifdef CH_USE_HDF5
+  // Hand the snapshot to the I/O thread and return to time stepping. Only rank 0 holds the data and writes the file.
+  if (asyncPlot && procID() == 0) {
+    const PlotSnapshot* snapshot = m_plotSnapshot.get();
+
+    m_plotFuture = std::async(std::launch::async, [snapshot]() -> void {
+      Driver::writePlotSnapshot(*snapshot);
+    });
+  }
+#endif
+}
+
+Real
+Driver::getPlotSnapshotMemory(const int a_maxPlotLevel, const int a_numPlotVariables) const noexcept
+{
+  CH_TIME("Driver::getPlotSnapshotMemory(int, int)");
+  if (m_verbosity > 5) {
+    pout() << "Driver::getPlotSnapshotMemory(int, int)" << endl;
+  }
+
+  // TLDR: The snapshot holds the plot variables plus the EB moments (volume fraction, boundary area, area fractions, normal,
+  //       and distance) on every plot level, including ghost cells.
+  const int numComp = a_numPlotVariables + 3 + 3 * SpaceDim;
+
+  long long numCells = 0LL;
+  for (int lvl = 0; lvl <= a_maxPlotLevel; lvl++) {
+    const DisjointBoxLayout& dbl = m_amr->getGrids(m_realm)[lvl];
+
+    for (LayoutIterator lit = dbl.layoutIterator(); lit.ok(); ++lit) {
+      numCells += grow(dbl[lit()], m_numPlotGhost).numPts();
+    }
+  }
+
+  return (1.0 * numCells * numComp * sizeof(Real)) / (1024.0 * 1024.0);
+}
+
+void
+Driver::waitForPlotFile()
+{
+  CH_TIME("Driver::waitForPlotFile()");
+
+  if (m_plotFuture.valid()) {
+    m_plotFuture.get();
+  }
+
+  // The snapshot is released on the main thread because it holds reference counted objects.
+  m_plotSnapshot.reset();
+}
+
+void
+Driver::writePlotSnapshot(const PlotSnapshot& a_snapshot) noexcept
+{
+  // TLDR: This runs on the I/O thread on rank 0. It only touches the snapshot, which is not shared with the rest of the code,
+  //       and DischargeIO::writeSerialEBHDF5 does not do any MPI calls and does not use the Chombo timers.
+#ifdef CH_USE_HDF5
+  DischargeIO::writeSerialEBHDF5(a_snapshot.filename,
+                                 a_snapshot.variableNames,
+                                 a_snapshot.levels,
+                                 a_snapshot.dt,
+                                 a_snapshot.time,
+                                 a_snapshot.numGhost,
+                                 a_snapshot.options);
+#endif
+}
+
+void
+Driver::extractFields()
+{
+  CH_TIME("Driver::extractFields()");
+  if (m_verbosity > 3) {
+    pout() << "Driver::extractFields()" << endl;
+  }
+
+  // HDF5 might not be thread-safe, so finish any outstanding plot file before FieldExtraction writes to HDF5.
+  this->waitForPlotFile();
+
+  // TLDR: This assembles the plot variables like writePlotFile does, but hands the data to FieldExtraction rather than
+  //       writing a plot file. The plot data providers (time stepper, cell tagger, and Driver) only write all of their
+  //       variables at once, so we skip the providers that don't have any of the requested variables. Likewise, we only
+  //       allocate and fill the levels that contain sample points.
+  const std::vector<std::string>& extractVariables = m_fieldExtraction.getVariables();
+
+  auto isRequested = [&](const Vector<std::string>& a_names) -> bool {
+    if (extractVariables.empty()) {
+      return a_names.size() > 0;
+    }
+
+    for (const auto& var : extractVariables) {
+      for (int i = 0; i < a_names.size(); i++) {
+        if (a_names[i] == var) {
+          return true;
+        }
+      }
+    }
+
+    return false;
+  };
+
+  const Vector<std::string> stepperVariables = m_timeStepper->getPlotVariableNames();
+  const Vector<std::string> taggerVariables  = m_cellTagger.isNull() ? Vector<std::string>()
+                                                                     : m_cellTagger->getPlotVariableNames();
+  const Vector<std::string> driverVariables  = this->getPlotVariableNames();
+
+  const bool extractStepper = isRequested(stepperVariables);
+  const bool extractTagger  = isRequested(taggerVariables);
+  const bool extractDriver  = isRequested(driverVariables);
+
+  Vector<std::string> plotVariableNames;
+  if (extractStepper) {
+    plotVariableNames.append(stepperVariables);
+  }
+  if (extractTagger) {
+    plotVariableNames.append(taggerVariables);
+  }
+  if (extractDriver) {
+    plotVariableNames.append(driverVariables);
+  }
+
+  const int numOutputComp = plotVariableNames.size();
+
+  if (numOutputComp > 0) {
+    if (extractStepper) {
+      m_timeStepper->preExtract();
+    }
+    if (extractTagger) {
+      m_cellTagger->prePlot();
+    }
+
+    const std::vector<bool>& levelHasSamples = m_fieldExtraction.getLevelsWithSamples();
+
+    const int finestLevel = m_amr->getFinestLevel();
+
+    EBAMRCellData outputData(1 + finestLevel);
+    outputData.setRealm(m_realm);
+
+    for (int lvl = 0; lvl <= finestLevel; lvl++) {
+      if (!levelHasSamples[lvl]) {
+        continue;
+      }
+
+      outputData[lvl] = RefCountedPtr<LevelData<EBCellFAB>>(new LevelData<EBCellFAB>());
+
+      m_amr->allocate(*outputData[lvl], m_realm, phase::gas, lvl, numOutputComp);
+      DataOps::setValue(*outputData[lvl], 0.0);
+
+      int comp = 0;
+
+      if (extractStepper) {
+        m_timeStepper->writePlotData(*outputData[lvl], comp, m_realm, lvl);
+      }
+      if (extractTagger) {
+        m_cellTagger->writePlotData(*outputData[lvl], comp, m_realm, lvl);
+      }
+      if (extractDriver) {
+        this->writePlotData(*outputData[lvl], comp, lvl);
+      }
+    }
+
+    m_fieldExtraction.extract(outputData, plotVariableNames, m_timeStep, m_time);
+
+    if (extractStepper) {
+      m_timeStepper->postExtract();
+    }
+  }
 }
 
 void
@@ -2534,6 +3110,9 @@ Driver::writeCheckpointFile()
     pout() << "Driver::writeCheckpointFile()" << endl;
   }
 
+  // HDF5 might not be thread-safe, so finish any outstanding plot file first.
+  this->waitForPlotFile();
+
 #ifdef CH_USE_HDF5
   const int finestLevel      = m_amr->getFinestLevel();
   int       finestCheckLevel = Min(m_maxCheckpointDepth, finestLevel);
@@ -0,0 +1,980 @@
+/* chombo-discharge
+ * Copyright © 2024 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_FieldExtraction.cpp
+  @brief  Implementation of CD_FieldExtraction.H
+  @author Robert Marskar
+*/
+
+// Std includes
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+#ifdef CH_USE_HDF5
+#include <hdf5.h>
+#endif
+
+// Chombo includes
+#include <ParmParse.H>
+#include <BoxIterator.H>
+
+// Our includes
+#include <CD_FieldExtraction.H>
+#include <CD_ParallelOps.H>
+#include <CD_NamespaceHeader.H>
+
+FieldExtraction::FieldExtraction() noexcept
+{
+  CH_TIME("FieldExtraction::FieldExtraction");
+
+  m_isDefined = false;
+  m_verbosity = -1;
+  m_interval  = -1;
+}
+
+FieldExtraction::~FieldExtraction() noexcept
+{
+  CH_TIME("FieldExtraction::~FieldExtraction");
+}
+
+void
+FieldExtraction::parseOptions() noexcept
+{
+  CH_TIME("FieldExtraction::parseOptions");
+
+  ParmParse pp("Driver");
+
+  pp.query("verbosity", m_verbosity);
+  if (m_verbosity > 5) {
+    pout() << "FieldExtraction::parseOptions" << endl;
+  }
+
+  m_interval = -1;
+  pp.query("extraction_interval", m_interval);
+
+  // Variables to extract.
+  m_variables.clear();
+  for (int i = 0; i < pp.countval("extraction_variables"); i++) {
+    std::string str;
+
+    pp.get("extraction_variables", str, i);
+
+    m_variables.emplace_back(str);
+  }
+
+  // Probes are given as a list of coordinates.
+  m_probes.clear();
+
+  const int numProbeValues = pp.countval("extraction_probes");
+  if (numProbeValues % SpaceDim != 0) {
+    MayDay::Error("FieldExtraction::parseOptions - 'Driver.extraction_probes' must have SpaceDim entries per probe");
+  }
+  if (numProbeValues > 0) {
+    Vector<Real> values(numProbeValues);
+
+    pp.getarr("extraction_probes", values, 0, numProbeValues);
+
+    for (int i = 0; i < numProbeValues; i += SpaceDim) {
+      RealVect probe;
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        probe[dir] = values[i + dir];
+      }
+
+      m_probes.emplace_back(probe);
+    }
+  }
+
+  // Lines are given as start point, end point, and number of points
+  m_lines.clear();
+
+  const int lineSize      = 2 * SpaceDim + 1;
+  const int numLineValues = pp.countval("extraction_lines");
+  if (numLineValues % lineSize != 0) {
+    MayDay::Error("FieldExtraction::parseOptions - 'Driver.extraction_lines' must have 2*SpaceDim+1 entries per line");
+  }
+  if (numLineValues > 0) {
+    Vector<Real> values(numLineValues);
+
+    pp.getarr("extraction_lines", values, 0, numLineValues);
+
+    for (int i = 0; i < numLineValues; i += lineSize) {
+      Line line;
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        line.m_lo[dir] = values[i + dir];
+        line.m_hi[dir] = values[i + SpaceDim + dir];
+      }
+      line.m_numPoints = std::lround(values[i + 2 * SpaceDim]);
+
+      if (line.m_numPoints < 1) {
+        MayDay::Error("FieldExtraction::parseOptions - line-outs must have at least one point");
+      }
+
+      m_lines.emplace_back(line);
+    }
+  }
+
+  // Slices are given as direction, position, and AMR level.
+  m_slices.clear();
+
+  const int numSliceValues = pp.countval("extraction_slices");
+  if (numSliceValues % 3 != 0) {
+    MayDay::Error("FieldExtraction::parseOptions - 'Driver.extraction_slices' must have three entries per slice");
+  }
+  if (numSliceValues > 0) {
+    Vector<Real> values(numSliceValues);
+
+    pp.getarr("extraction_slices", values, 0, numSliceValues);
+
+    for (int i = 0; i < numSliceValues; i += 3) {
+      Slice slice;
+
+      slice.m_dir       = std::lround(values[i]);
+      slice.m_position  = values[i + 1];
+      slice.m_level     = std::lround(values[i + 2]);
+      slice.m_numPoints = IntVect::Unit;
+      slice.m_firstCell = IntVect::Zero;
+
+      if (slice.m_dir < 0 || slice.m_dir >= SpaceDim) {
+        MayDay::Error("FieldExtraction::parseOptions - slice direction must be between 0 and SpaceDim-1");
+      }
+      if (slice.m_level < 0) {
+        MayDay::Error("FieldExtraction::parseOptions - slice level must be >= 0");
+      }
+
+      m_slices.emplace_back(slice);
+    }
+  }
+}
+
+void
+FieldExtraction::parseRuntimeOptions() noexcept
+{
+  CH_TIME("FieldExtraction::parseRuntimeOptions");
+  if (m_verbosity > 5) {
+    pout() << "FieldExtraction::parseRuntimeOptions" << endl;
+  }
+
+  ParmParse pp("Driver");
+
+  pp.query("verbosity", m_verbosity);
+  pp.query("extraction_interval", m_interval);
+}
+
+void
+FieldExtraction::define(const RefCountedPtr<AmrMesh>& a_amr,
+                        const std::string             a_realm,
+                        const std::string             a_outputPrefix,
+                        const bool                    a_append) noexcept
+{
+  CH_TIME("FieldExtraction::define");
+  if (m_verbosity > 5) {
+    pout() << "FieldExtraction::define" << endl;
+  }
+
+  CH_assert(!a_amr.isNull());
+
+  m_amr          = a_amr;
+  m_realm        = a_realm;
+  m_outputPrefix = a_outputPrefix;
+
+  m_mappedGrids.resize(0);
+  m_patchPoints.resize(0);
+
+  this->defineSamplePoints();
+
+  // Master rank creates the output files, unless we append to existing files.
+  if (procID() == 0 && !m_points.empty()) {
+    bool filesExist = true;
+
+    if (!m_probes.empty()) {
+      filesExist = filesExist && std::ifstream(this->getProbeFileName()).good();
+    }
+    if (!(m_lines.empty() && m_slices.empty())) {
+      filesExist = filesExist && std::ifstream(this->getFieldFileName()).good();
+    }
+
+    if (!a_append || !filesExist) {
+      this->createFiles();
+    }
+  }
+
+  m_isDefined = true;
+}
+
+bool
+FieldExtraction::isEnabled() const noexcept
+{
+  CH_TIME("FieldExtraction::isEnabled");
+
+  return m_interval > 0 && !(m_probes.empty() && m_lines.empty() && m_slices.empty());
+}
+
+bool
+FieldExtraction::isExtractionStep(const int a_timeStep) const noexcept
+{
+  CH_TIME("FieldExtraction::isExtractionStep");
+
+  return m_isDefined && this->isEnabled() && (a_timeStep % m_interval == 0);
+}
+
+void
+FieldExtraction::defineSamplePoints() noexcept
+{
+  CH_TIME("FieldExtraction::defineSamplePoints");
+  if (m_verbosity > 5) {
+    pout() << "FieldExtraction::defineSamplePoints" << endl;
+  }
+
+  const RealVect probLo = m_amr->getProbLo();
+  const RealVect probHi = m_amr->getProbHi();
+
+  auto isInside = [&](const RealVect& a_pos) -> bool {
+    bool inside = true;
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      inside = inside && (a_pos[dir] >= probLo[dir]) && (a_pos[dir] <= probHi[dir]);
+    }
+
+    return inside;
+  };
+
+  m_points.resize(0);
+  m_lineOffsets.resize(0);
+  m_sliceOffsets.resize(0);
+
+  // Probes go first.
+  for (const auto& probe : m_probes) {
+    if (!isInside(probe)) {
+      MayDay::Error("FieldExtraction::defineSamplePoints - probe is outside the domain");
+    }
+
+    m_points.emplace_back(probe);
+  }
+
+  // Then the line-outs. These are equally spaced points between (and including) the end points.
+  for (const auto& line : m_lines) {
+    if (!isInside(line.m_lo) || !isInside(line.m_hi)) {
+      MayDay::Error("FieldExtraction::defineSamplePoints - line-out is outside the domain");
+    }
+
+    m_lineOffsets.emplace_back(m_points.size());
+
+    for (int i = 0; i < line.m_numPoints; i++) {
+      const Real t = (line.m_numPoints > 1) ? Real(i) / Real(line.m_numPoints - 1) : 0.0;
+
+      m_points.emplace_back(line.m_lo + t * (line.m_hi - line.m_lo));
+    }
+  }
+
+  // Then the slices. These are sampled at the cell centers on the requested level, with the direction normal to the slice
+  // collapsed to a single cell. The points are ordered with the x-coordinate running fastest.
+  for (auto& slice : m_slices) {
+    if (slice.m_level > m_amr->getMaxAmrDepth()) {
+      MayDay::Error("FieldExtraction::defineSamplePoints - slice level exceeds the maximum AMR depth");
+    }
+    if (slice.m_position < probLo[slice.m_dir] || slice.m_position > probHi[slice.m_dir]) {
+      MayDay::Error("FieldExtraction::defineSamplePoints - slice is outside the domain");
+    }
+
+    const Real dx = m_amr->getDx()[slice.m_level];
+
+    Box sliceBox = m_amr->getDomains()[slice.m_level].domainBox();
+    sliceBox.setSmall(slice.m_dir, 0);
+    sliceBox.setBig(slice.m_dir, 0);
+
+    slice.m_firstCell = sliceBox.smallEnd();
+    slice.m_numPoints = sliceBox.size();
+
+    m_sliceOffsets.emplace_back(m_points.size());
+
+    for (BoxIterator bit(sliceBox); bit.ok(); ++bit) {
+      RealVect pos = probLo + (RealVect(bit()) + 0.5 * RealVect::Unit) * dx;
+
+      pos[slice.m_dir] = slice.m_position;
+
+      m_points.emplace_back(pos);
+    }
+  }
+}
+
+IntVect
+FieldExtraction::getCell(const RealVect& a_position, const int a_level) const noexcept
+{
+  const Real     dx        = m_amr->getDx()[a_level];
+  const RealVect probLo    = m_amr->getProbLo();
+  const Box      domainBox = m_amr->getDomains()[a_level].domainBox();
+
+  IntVect iv;
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    iv[dir] = std::floor((a_position[dir] - probLo[dir]) / dx);
+
+    // Points on the upper domain boundary go into the last cell.
+    iv[dir] = std::max(domainBox.smallEnd(dir), std::min(domainBox.bigEnd(dir), iv[dir]));
+  }
+
+  return iv;
+}
+
+bool
+FieldExtraction::gridsChanged() const noexcept
+{
+  CH_TIME("FieldExtraction::gridsChanged");
+
+  const Vector<DisjointBoxLayout>& grids = m_amr->getGrids(m_realm);
+
+  const int finestLevel = m_amr->getFinestLevel();
+
+  bool changed = (int(m_mappedGrids.size()) != finestLevel + 1);
+
+  for (int lvl = 0; lvl <= finestLevel && !changed; lvl++) {
+    changed = !(m_mappedGrids[lvl] == grids[lvl]);
+  }
+
+  return changed;
+}
+
+void
+FieldExtraction::getPatchPoints(std::vector<PatchPoint>& a_patchPoints, const Box& a_box, const int a_level) const noexcept
+{
+  // TLDR: This finds the sample points inside a grid patch directly from the sample geometry. Probes are tested one by one,
+  //       line-outs are clipped against the patch, and for the slices we compute the range of slice cells that overlap
+  //       the patch. The clipping is padded by one cell, and getCell has the final say (it clamps points on the upper
+  //       domain boundary). The cost is proportional to the number of points in the patch plus the number of probes/lines.
+  const Real     dx     = m_amr->getDx()[a_level];
+  const RealVect probLo = m_amr->getProbLo();
+  const RealVect boxLo  = probLo + RealVect(a_box.smallEnd()) * dx;
+  const RealVect boxHi  = probLo + RealVect(a_box.bigEnd() + IntVect::Unit) * dx;
+
+  a_patchPoints.resize(0);
+
+  auto addPoint = [&](const int a_index) -> void {
+    const IntVect iv = this->getCell(m_points[a_index], a_level);
+
+    if (a_box.contains(iv)) {
+      a_patchPoints.emplace_back(a_index, iv);
+    }
+  };
+
+  // Probes
+  for (int iprobe = 0; iprobe < m_probes.size(); iprobe++) {
+    addPoint(iprobe);
+  }
+
+  // Line-outs. Compute the parameter interval [t0, t1] where the line is inside the (padded) patch.
+  for (int iline = 0; iline < m_lines.size(); iline++) {
+    const Line& line      = m_lines[iline];
+    const int   numPoints = line.m_numPoints;
+    const int   offset    = m_lineOffsets[iline];
+
+    if (numPoints == 1) {
+      addPoint(offset);
+
+      continue;
+    }
+
+    Real t0 = 0.0;
+    Real t1 = 1.0;
+
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      const Real lo    = boxLo[dir] - dx;
+      const Real hi    = boxHi[dir] + dx;
+      const Real delta = line.m_hi[dir] - line.m_lo[dir];
+
+      if (std::abs(delta) > 0.0) {
+        const Real ta = (lo - line.m_lo[dir]) / delta;
+        const Real tb = (hi - line.m_lo[dir]) / delta;
+
+        t0 = std::max(t0, std::min(ta, tb));
+        t1 = std::min(t1, std::max(ta, tb));
+      }
+      else if (line.m_lo[dir] < lo || line.m_lo[dir] > hi) {
+        t1 = -1.0;
+      }
+    }
+
+    if (t0 <= t1) {
+      const int first = std::max(0, int(std::floor(t0 * (numPoints - 1))));
+      const int last  = std::min(numPoints - 1, int(std::ceil(t1 * (numPoints - 1))));
+
+      for (int i = first; i <= last; i++) {
+        addPoint(offset + i);
+      }
+    }
+  }
+
+  // Slices. The points are stored with the x-direction running fastest (see defineSamplePoints).
+  for (int islice = 0; islice < m_slices.size(); islice++) {
+    const Slice& slice  = m_slices[islice];
+    const int    dir    = slice.m_dir;
+    const int    offset = m_sliceOffsets[islice];
+    const Real   sdx    = m_amr->getDx()[slice.m_level];
+
+    // All points on the slice are in the same cell in the normal direction.
+    const int normalCell = this->getCell(m_points[offset], a_level)[dir];
+
+    if (normalCell < a_box.smallEnd(dir) || normalCell > a_box.bigEnd(dir)) {
+      continue;
+    }
+
+    IntVect lo = slice.m_firstCell;
+    IntVect hi = slice.m_firstCell;
+    for (int d = 0; d < SpaceDim; d++) {
+      if (d != dir) {
+        lo[d] = int(std::floor((boxLo[d] - probLo[d]) / sdx)) - 1;
+        hi[d] = int(std::ceil((boxHi[d] - probLo[d]) / sdx)) + 1;
+      }
+    }
+
+    Box range(slice.m_firstCell, slice.m_firstCell + slice.m_numPoints - IntVect::Unit);
+    range &= Box(lo, hi);
+
+    if (range.isEmpty()) {
+      continue;
+    }
+
+    IntVect stride = IntVect::Unit;
+    for (int d = 1; d < SpaceDim; d++) {
+      stride[d] = stride[d - 1] * slice.m_numPoints[d - 1];
+    }
+
+    for (BoxIterator bit(range); bit.ok(); ++bit) {
+      const IntVect iv = bit() - slice.m_firstCell;
+
+      int index = offset;
+      for (int d = 0; d < SpaceDim; d++) {
+        index += iv[d] * stride[d];
+      }
+
+      addPoint(index);
+    }
+  }
+}
+
+void
+FieldExtraction::mapSamplePoints() noexcept
+{
+  CH_TIME("FieldExtraction::mapSamplePoints");
+  if (m_verbosity > 5) {
+    pout() << "FieldExtraction::mapSamplePoints" << endl;
+  }
+
+  // TLDR: Each rank finds the sample points in its own grid patches on every level (see getPatchPoints). The finest level
+  //       that contains each point is found with a single max-reduction, and points are then only kept on that level.
+  //       Finally, rank 0 gathers the indices of the points owned by each rank. During extraction each rank then only
+  //       sends the values for its own points to rank 0. This only runs when the grids change.
+
+  const Vector<DisjointBoxLayout>& grids = m_amr->getGrids(m_realm);
+
+  const int finestLevel = m_amr->getFinestLevel();
+  const int numPoints   = m_points.size();
+
+  m_mappedGrids.resize(finestLevel + 1);
+  m_patchPoints.resize(finestLevel + 1);
+
+  Vector<int> pointLevel(numPoints, -1);
+
+  for (int lvl = 0; lvl <= finestLevel; lvl++) {
+    const DisjointBoxLayout& dbl = grids[lvl];
+    const DataIterator&      dit = dbl.dataIterator();
+
+    const int nbox = dit.size();
+
+    m_mappedGrids[lvl] = dbl;
+    m_patchPoints[lvl] = RefCountedPtr<LayoutData<std::vector<PatchPoint>>>(
+      new LayoutData<std::vector<PatchPoint>>(dbl));
+
+#pragma omp parallel for schedule(runtime)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      std::vector<PatchPoint>& patchPoints = (*m_patchPoints[lvl])[din];
+
+      this->getPatchPoints(patchPoints, dbl[din], lvl);
+
+      // Patches on a level are disjoint so only one thread writes to each point.
+      for (const auto& p : patchPoints) {
+        pointLevel[p.first] = lvl;
+      }
+    }
+  }
+
+  ParallelOps::vectorMax(pointLevel);
+
+  // Remove points that are covered by a finer level and figure out which levels have sample points.
+  m_levelHasSamples.assign(finestLevel + 1, false);
+  for (int i = 0; i < numPoints; i++) {
+    if (pointLevel[i] >= 0) {
+      m_levelHasSamples[pointLevel[i]] = true;
+    }
+  }
+
+  m_localPoints.resize(0);
+
+  for (int lvl = 0; lvl <= finestLevel; lvl++) {
+    const DataIterator& dit = grids[lvl].dataIterator();
+
+    const int nbox = dit.size();
+
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      std::vector<PatchPoint>& patchPoints = (*m_patchPoints[lvl])[dit[mybox]];
+
+      patchPoints.erase(std::remove_if(patchPoints.begin(),
+                                       patchPoints.end(),
+                                       [&](const PatchPoint& p) -> bool {
+                                         return pointLevel[p.first] != lvl;
+                                       }),
+                        patchPoints.end());
+
+      for (const auto& p : patchPoints) {
+        m_localPoints.emplace_back(p.first);
+      }
+    }
+  }
+
+  // Rank 0 gathers the indices of the points on each rank.
+#ifdef CH_MPI
+  const int numLocalPoints = m_localPoints.size();
+
+  m_rankCounts.assign(numProc(), 0);
+  MPI_Gather(&numLocalPoints, 1, MPI_INT, m_rankCounts.data(), 1, MPI_INT, 0, Chombo_MPI::comm);
+
+  std::vector<int> displs(numProc(), 0);
+  for (int irank = 1; irank < numProc(); irank++) {
+    displs[irank] = displs[irank - 1] + m_rankCounts[irank - 1];
+  }
+
+  m_rankPoints.resize((procID() == 0) ? displs.back() + m_rankCounts.back() : 0);
+
+  MPI_Gatherv(m_localPoints.data(),
+              numLocalPoints,
+              MPI_INT,
+              m_rankPoints.data(),
+              m_rankCounts.data(),
+              displs.data(),
+              MPI_INT,
+              0,
+              Chombo_MPI::comm);
+#else
+  m_rankPoints = m_localPoints;
+#endif
+}
+
+const std::vector<std::string>&
+FieldExtraction::getVariables() const noexcept
+{
+  return m_variables;
+}
+
+const std::vector<bool>&
+FieldExtraction::getLevelsWithSamples() noexcept
+{
+  CH_TIME("FieldExtraction::getLevelsWithSamples");
+
+  CH_assert(m_isDefined);
+
+  if (this->gridsChanged()) {
+    this->mapSamplePoints();
+  }
+
+  return m_levelHasSamples;
+}
+
+void
+FieldExtraction::extract(const EBAMRCellData&       a_data,
+                         const Vector<std::string>& a_variableNames,
+                         const int                  a_timeStep,
+                         const Real                 a_time) noexcept
+{
+  CH_TIME("FieldExtraction::extract");
+  if (m_verbosity > 5) {
+    pout() << "FieldExtraction::extract" << endl;
+  }
+
+  CH_assert(m_isDefined);
+
+  if (m_points.empty()) {
+    return;
+  }
+
+  if (this->gridsChanged()) {
+    this->mapSamplePoints();
+  }
+
+  // Figure out which components to extract.
+  std::vector<int>         comps;
+  std::vector<std::string> variableNames;
+
+  if (m_variables.empty()) {
+    for (int i = 0; i < a_variableNames.size(); i++) {
+      comps.emplace_back(i);
+      variableNames.emplace_back(a_variableNames[i]);
+    }
+  }
+  else {
+    for (const auto& var : m_variables) {
+      bool foundVar = false;
+
+      for (int i = 0; i < a_variableNames.size(); i++) {
+        if (a_variableNames[i] == var) {
+          comps.emplace_back(i);
+          variableNames.emplace_back(var);
+
+          foundVar = true;
+
+          break;
+        }
+      }
+
+      if (!foundVar && m_verbosity > 0) {
+        pout() << "FieldExtraction::extract - could not find plot variable '" << var << "'" << endl;
+      }
+    }
+  }
+
+  const int numVars   = comps.size();
+  const int numPoints = m_points.size();
+
+  // Sample the points on this rank, in the same order as m_localPoints. Data only needs to exist on levels with samples.
+  std::vector<Real> localValues(m_localPoints.size() * numVars);
+
+  int offset = 0;
+  for (int lvl = 0; lvl < m_patchPoints.size(); lvl++) {
+    if (!m_levelHasSamples[lvl]) {
+      continue;
+    }
+
+    CH_assert(a_data[lvl]->nComp() == int(a_variableNames.size()));
+    CH_assert(a_data[lvl]->disjointBoxLayout() == m_mappedGrids[lvl]);
+
+    const DataIterator& dit = m_mappedGrids[lvl].dataIterator();
+
+    const int nbox = dit.size();
+
+    std::vector<int> boxOffsets(nbox);
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      boxOffsets[mybox] = offset;
+
+      offset += (*m_patchPoints[lvl])[dit[mybox]].size();
+    }
+
+#pragma omp parallel for schedule(runtime)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      const BaseFab<Real>&           data        = (*a_data[lvl])[din].getSingleValuedFAB();
+      const std::vector<PatchPoint>& patchPoints = (*m_patchPoints[lvl])[din];
+
+      for (int i = 0; i < patchPoints.size(); i++) {
+        for (int ivar = 0; ivar < numVars; ivar++) {
+          localValues[(boxOffsets[mybox] + i) * numVars + ivar] = data(patchPoints[i].second, comps[ivar]);
+        }
+      }
+    }
+  }
+
+  // Send the values to rank 0.
+  std::vector<Real> gatheredValues;
+#ifdef CH_MPI
+  std::vector<int> recvCounts(numProc(), 0);
+  std::vector<int> displs(numProc(), 0);
+
+  if (procID() == 0) {
+    for (int irank = 0; irank < numProc(); irank++) {
+      recvCounts[irank] = m_rankCounts[irank] * numVars;
+      displs[irank]     = (irank > 0) ? displs[irank - 1] + recvCounts[irank - 1] : 0;
+    }
+
+    gatheredValues.resize(m_rankPoints.size() * numVars);
+  }
+
+  MPI_Gatherv(localValues.data(),
+              localValues.size(),
+              MPI_CH_REAL,
+              gatheredValues.data(),
+              recvCounts.data(),
+              displs.data(),
+              MPI_CH_REAL,
+              0,
+              Chombo_MPI::comm);
+#else
+  gatheredValues = localValues;
+#endif
+
+  if (procID() == 0) {
+    std::vector<Real> values(numPoints * numVars, 0.0);
+
+    for (int i = 0; i < m_rankPoints.size(); i++) {
+      for (int ivar = 0; ivar < numVars; ivar++) {
+        values[m_rankPoints[i] * numVars + ivar] = gatheredValues[i * numVars + ivar];
+      }
+    }
+
+    if (!m_probes.empty()) {
+      this->writeProbes(values, variableNames, a_timeStep, a_time);
+    }
+    if (!(m_lines.empty() && m_slices.empty())) {
+      this->writeLinesAndSlices(values, variableNames, a_timeStep, a_time);
+    }
+  }
+}
+
+std::string
+FieldExtraction::getProbeFileName() const noexcept
+{
+  return m_outputPrefix + ".probes.csv";
+}
+
+std::string
+FieldExtraction::getFieldFileName() const noexcept
+{
+  return m_outputPrefix + ".extraction.hdf5";
+}
+
+void
+FieldExtraction::createFiles() const noexcept
+{
+  CH_TIME("FieldExtraction::createFiles");
+  if (m_verbosity > 5) {
+    pout() << "FieldExtraction::createFiles" << endl;
+  }
+
+  // Probe file. The header is written together with the first row because the variable names are not known yet.
+  if (!m_probes.empty()) {
+    std::ofstream f(this->getProbeFileName(), std::ios_base::trunc);
+
+    f.close();
+  }
+
+#ifdef CH_USE_HDF5
+  // HDF5 file for lines and slices. We store the sample geometry in the "geometry" group so the data can be plotted.
+  if (!(m_lines.empty() && m_slices.empty())) {
+    hid_t fileID  = H5Fcreate(this->getFieldFileName().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    hid_t groupID = H5Gcreate2(fileID, "geometry", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+    for (int iline = 0; iline < m_lines.size(); iline++) {
+      const int numPoints = m_lines[iline].m_numPoints;
+
+      std::vector<double> coords;
+      for (int i = 0; i < numPoints; i++) {
+        for (int dir = 0; dir < SpaceDim; dir++) {
+          coords.emplace_back(m_points[m_lineOffsets[iline] + i][dir]);
+        }
+      }
+
+      hsize_t dims[2];
+      dims[0] = numPoints;
+      dims[1] = SpaceDim;
+
+      const std::string name = "line_" + std::to_string(iline);
+
+      hid_t space   = H5Screate_simple(2, dims, nullptr);
+      hid_t dataset =
+        H5Dcreate2(groupID, name.c_str(), H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+      H5Dwrite(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, coords.data());
+
+      H5Dclose(dataset);
+      H5Sclose(space);
+    }
+
+    // For the slices we store the normal direction, position, grid spacing, and the coordinates of the first point.
+    for (int islice = 0; islice < m_slices.size(); islice++) {
+      const Slice& slice = m_slices[islice];
+
+      const std::string name = "slice_" + std::to_string(islice);
+
+      hid_t sliceGroup = H5Gcreate2(groupID, name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+      const int    dir      = slice.m_dir;
+      const double position = slice.m_position;
+      const double dx       = m_amr->getDx()[slice.m_level];
+
+      double lo[SpaceDim];
+      for (int d = 0; d < SpaceDim; d++) {
+        lo[d] = m_points[m_sliceOffsets[islice]][d];
+      }
+
+      hid_t scal = H5Screate(H5S_SCALAR);
+      hid_t attr = H5Acreate2(sliceGroup, "dir", H5T_NATIVE_INT, scal, H5P_DEFAULT, H5P_DEFAULT);
+      H5Awrite(attr, H5T_NATIVE_INT, &dir);
+      H5Aclose(attr);
+
+      attr = H5Acreate2(sliceGroup, "position", H5T_NATIVE_DOUBLE, scal, H5P_DEFAULT, H5P_DEFAULT);
+      H5Awrite(attr, H5T_NATIVE_DOUBLE, &position);
+      H5Aclose(attr);
+
+      attr = H5Acreate2(sliceGroup, "dx", H5T_NATIVE_DOUBLE, scal, H5P_DEFAULT, H5P_DEFAULT);
+      H5Awrite(attr, H5T_NATIVE_DOUBLE, &dx);
+      H5Aclose(attr);
+      H5Sclose(scal);
+
+      hsize_t vecDims = SpaceDim;
+      hid_t   vec     = H5Screate_simple(1, &vecDims, nullptr);
+
+      attr = H5Acreate2(sliceGroup, "lo", H5T_NATIVE_DOUBLE, vec, H5P_DEFAULT, H5P_DEFAULT);
+      H5Awrite(attr, H5T_NATIVE_DOUBLE, lo);
+      H5Aclose(attr);
+      H5Sclose(vec);
+
+      H5Gclose(sliceGroup);
+    }
+
+    H5Gclose(groupID);
+    H5Fclose(fileID);
+  }
+#endif
+}
+
+void
+FieldExtraction::writeProbes(const std::vector<Real>&        a_values,
+                             const std::vector<std::string>& a_variableNames,
+                             const int                       a_timeStep,
+                             const Real                      a_time) const noexcept
+{
+  CH_TIME("FieldExtraction::writeProbes");
+  if (m_verbosity > 5) {
+    pout() << "FieldExtraction::writeProbes" << endl;
+  }
+
+  const int numVars = a_variableNames.size();
+
+  std::ofstream f(this->getProbeFileName(), std::ios_base::app);
+
+  f.seekp(0, std::ios_base::end);
+
+  // Write the header if this is a new file.
+  if (f.tellp() == 0) {
+    f << "step,time";
+    for (int iprobe = 0; iprobe < m_probes.size(); iprobe++) {
+      for (int ivar = 0; ivar < numVars; ivar++) {
+        f << ",probe" << iprobe << "/" << a_variableNames[ivar];
+      }
+    }
+    f << "\n";
+  }
+
+  f << std::scientific << std::setprecision(std::numeric_limits<Real>::digits10 + 1);
+  f << a_timeStep << "," << a_time;
+  for (int iprobe = 0; iprobe < m_probes.size(); iprobe++) {
+    for (int ivar = 0; ivar < numVars; ivar++) {
+      f << "," << a_values[iprobe * numVars + ivar];
+    }
+  }
+  f << "\n";
+
+  f.close();
+}
+
+void
+FieldExtraction::writeLinesAndSlices(const std::vector<Real>&        a_values,
+                                     const std::vector<std::string>& a_variableNames,
+                                     const int                       a_timeStep,
+                                     const Real                      a_time) const noexcept
+{
+  CH_TIME("FieldExtraction::writeLinesAndSlices");
+  if (m_verbosity > 5) {
+    pout() << "FieldExtraction::writeLinesAndSlices" << endl;
+  }
+
+#ifdef CH_USE_HDF5
+  // TLDR: Each extraction goes into a group "stepXXXXXXX" with the time, step, and variable names as attributes. The data for
+  //       each line-out is stored as a (numPoints x numVars) array and the data for each slice as a (ny x nx x numVars)
+  //       array in 3D and as a (nx x numVars) array in 2D, where x and y are the tangential directions. If the group already
+  //       exists (e.g. after restarting from an earlier checkpoint), it is replaced.
+  const int numVars = a_variableNames.size();
+
+  hid_t fileID = H5Fopen(this->getFieldFileName().c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+  if (fileID < 0) {
+    MayDay::Warning("FieldExtraction::writeLinesAndSlices - could not open file");
+
+    return;
+  }
+
+  char groupName[100];
+  sprintf(groupName, "step%07d", a_timeStep);
+
+  if (H5Lexists(fileID, groupName, H5P_DEFAULT) > 0) {
+    H5Ldelete(fileID, groupName, H5P_DEFAULT);
+  }
+
+  hid_t groupID = H5Gcreate2(fileID, groupName, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+  // Attributes
+  const double time = a_time;
+
+  hid_t scal = H5Screate(H5S_SCALAR);
+  hid_t attr = H5Acreate2(groupID, "time", H5T_NATIVE_DOUBLE, scal, H5P_DEFAULT, H5P_DEFAULT);
+  H5Awrite(attr, H5T_NATIVE_DOUBLE, &time);
+  H5Aclose(attr);
+
+  attr = H5Acreate2(groupID, "step", H5T_NATIVE_INT, scal, H5P_DEFAULT, H5P_DEFAULT);
+  H5Awrite(attr, H5T_NATIVE_INT, &a_timeStep);
+  H5Aclose(attr);
+
+  for (int ivar = 0; ivar < numVars; ivar++) {
+    const std::string label = "component_" + std::to_string(ivar);
+    const std::string var   = a_variableNames[ivar];
+
+    hid_t stringType = H5Tcopy(H5T_C_S1);
+    H5Tset_size(stringType, std::max(size_t(1), var.size()));
+
+    attr = H5Acreate2(groupID, label.c_str(), stringType, scal, H5P_DEFAULT, H5P_DEFAULT);
+    H5Awrite(attr, stringType, var.c_str());
+    H5Aclose(attr);
+    H5Tclose(stringType);
+  }
+  H5Sclose(scal);
+
+  auto writeData = [&](const std::string& a_name, const int a_firstPoint, const std::vector<hsize_t>& a_dims) -> void {
+    hsize_t numValues = 1;
+    for (const auto& d : a_dims) {
+      numValues *= d;
+    }
+
+    std::vector<double> data(numValues);
+    for (hsize_t i = 0; i < numValues; i++) {
+      data[i] = a_values[a_firstPoint * numVars + i];
+    }
+
+    hid_t space   = H5Screate_simple(a_dims.size(), a_dims.data(), nullptr);
+    hid_t dataset =
+      H5Dcreate2(groupID, a_name.c_str(), H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+    H5Dwrite(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+
+    H5Dclose(dataset);
+    H5Sclose(space);
+  };
+
+  for (int iline = 0; iline < m_lines.size(); iline++) {
+    const std::vector<hsize_t> dims{hsize_t(m_lines[iline].m_numPoints), hsize_t(numVars)};
+
+    writeData("line_" + std::to_string(iline), m_lineOffsets[iline], dims);
+  }
+
+  for (int islice = 0; islice < m_slices.size(); islice++) {
+    const Slice& slice = m_slices[islice];
+
+    // Tangential directions, with the slowest varying direction first.
+    std::vector<hsize_t> dims;
+    for (int dir = SpaceDim - 1; dir >= 0; dir--) {
+      if (dir != slice.m_dir) {
+        dims.emplace_back(slice.m_numPoints[dir]);
+      }
+    }
+    dims.emplace_back(numVars);
+
+    writeData("slice_" + std::to_string(islice), m_sliceOffsets[islice], dims);
+  }
+
+  H5Gclose(groupID);
+  H5Fclose(fileID);
+#endif
+}
+
+#include <CD_NamespaceFooter.H>
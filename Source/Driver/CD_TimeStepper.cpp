@@ -148,4 +148,14 @@ void
 TimeStepper::postPlot()
 {}
 
+void
+TimeStepper::preExtract()
+{
+  this->prePlot();
+}
+
+void
+TimeStepper::postExtract()
+{}
+
 #include <CD_NamespaceFooter.H>
@@ -40,6 +40,8 @@ FieldSolver::FieldSolver()
   m_isVoltageSet = false;
   m_regridSlopes = true;
   m_verbosity    = -1;
+  m_time         = 0.0;
+  m_solutionTime = 0.0;
 
   this->setDataLocation(Location::Cell::Center);
   this->setDefaultDomainBcFunctions();
@@ -113,6 +115,57 @@ FieldSolver::solve(MFAMRCellData& a_potential, const bool a_zeroPhi)
   return converged;
 }
 
+bool
+FieldSolver::solve(Vector<MFAMRCellData*>&             a_phi,
+                   Vector<MFAMRCellData*>&             a_electricField,
+                   const Vector<const MFAMRCellData*>& a_rho,
+                   const Vector<const EBAMRIVData*>&   a_sigma,
+                   const Vector<Real>&                 a_voltage,
+                   const bool                          a_zeroPhi)
+{
+  CH_TIME("FieldSolver::solve(Vector<MFAMRCellData*>, Vector<MFAMRCellData*>, ...)");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolver::solve(Vector<MFAMRCellData*>, Vector<MFAMRCellData*>, ...)" << endl;
+  }
+
+  const int numRHS = a_phi.size();
+
+  CH_assert(a_electricField.size() == numRHS);
+  CH_assert(a_rho.size() == numRHS);
+  CH_assert(a_sigma.size() == numRHS);
+  CH_assert(a_voltage.size() == numRHS);
+
+  // TLDR: Each right-hand side is solved with a constant voltage. Solvers that cache a set-up solver (e.g. the multigrid hierarchy) reuse it for
+  //       all right-hand sides since the boundary conditions read the voltage through m_voltage. The voltage function is restored afterwards.
+  const auto voltageBackup = m_voltage;
+  const bool isVoltageSet  = m_isVoltageSet;
+
+  bool converged = true;
+
+  for (int i = 0; i < numRHS; i++) {
+    const Real voltage = a_voltage[i];
+
+    this->setVoltage([voltage](const Real a_time) -> Real {
+      return voltage;
+    });
+
+    const bool curConverged = this->solve(*a_phi[i], *a_rho[i], *a_sigma[i], a_zeroPhi);
+
+    if (!curConverged && m_verbosity > 0) {
+      pout() << "FieldSolver::solve(Vector<MFAMRCellData*>, ...) - right-hand side " << i << " did not converge" << endl;
+    }
+
+    converged = converged && curConverged;
+
+    this->computeElectricField(*a_electricField[i], *a_phi[i]);
+  }
+
+  m_voltage      = voltageBackup;
+  m_isVoltageSet = isVoltageSet;
+
+  return converged;
+}
+
 void
 FieldSolver::setSolverPermittivities(const MFAMRCellData& a_permittivityCell,
                                      const MFAMRFluxData& a_permittivityFace,
@@ -547,9 +600,21 @@ FieldSolver::setTime(const int a_timeStep, const Real a_time, const Real a_dt)
     pout() << "FieldSolver::setTime(int, Real, Real)" << endl;
   }
 
-  m_timeStep = a_timeStep;
-  m_time     = a_time;
-  m_dt       = a_dt;
+  m_timeStep     = a_timeStep;
+  m_time         = a_time;
+  m_dt           = a_dt;
+  m_solutionTime = a_time;
+}
+
+void
+FieldSolver::setSolutionTime(const Real a_time)
+{
+  CH_TIME("FieldSolver::setSolutionTime(Real)");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolver::setSolutionTime(Real)" << endl;
+  }
+
+  m_solutionTime = a_time;
 }
 
 void
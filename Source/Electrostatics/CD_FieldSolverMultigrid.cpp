@@ -10,6 +10,11 @@
   @todo   Once the new operator is in, check the computeLoads routine. 
 */
 
+// Std includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 // Chombo includes
 #include <ParmParse.H>
 
@@ -23,6 +28,9 @@
 #include <CD_MFHelmholtzJumpBCFactory.H>
 #include <CD_MFHelmholtzSaturationChargeJumpBCFactory.H>
 #include <CD_Units.H>
+#include <CD_BoxLoops.H>
+#include <CD_Timer.H>
+#include <CD_ParallelOps.H>
 #include <CD_NamespaceHeader.H>
 
 constexpr Real FieldSolverMultigrid::m_alpha;
@@ -33,8 +41,13 @@ FieldSolverMultigrid::FieldSolverMultigrid() : FieldSolver()
   CH_TIME("FieldSolverMultigrid::FieldSolverMultigrid()");
 
   // Default settings
-  m_isSolverSetup = false;
-  m_className     = "FieldSolverMultigrid";
+  m_isSolverSetup      = false;
+  m_multigridNeedsFMG  = false;
+  m_multigridNumCycles = 0;
+  m_multigridZeroResid = -1.0;
+  m_predictorOrder     = 0;
+  m_multigridReuseNorm = false;
+  m_className          = "FieldSolverMultigrid";
 }
 
 FieldSolverMultigrid::~FieldSolverMultigrid()
@@ -72,6 +85,11 @@ FieldSolverMultigrid::parseRuntimeOptions()
   this->parseKappaSource();
   this->parsePlotVariables();
   this->parseRegridSlopes();
+
+  // The cycle type and iteration counts might have changed.
+  if (m_isSolverSetup && !m_multigridSolver.isNull()) {
+    this->setMultigridIterations(m_multigridMinIterations, m_multigridMaxIterations);
+  }
 }
 
 void
@@ -147,7 +165,7 @@ FieldSolverMultigrid::parseMultigridSettings()
       "FieldSolverMultigrid::parseMultigridSettings() - logic bust in bottom solver. You must specify ' = bicgstab', ' = gmres', or ' = simple <number>'");
   }
 
-  // Get a string for the multigrid smoother. This must either be "jacobi", "red_black", or "multi_color".
+  // Get a string for the multigrid smoother. This must either be "jacobi", "red_black", "multi_color", or "red_black_deep".
   pp.get("gmg_smoother", str);
   if (str == "jacobi") {
     m_multigridRelaxMethod = MFHelmholtzOp::Smoother::PointJacobi;
@@ -158,6 +176,9 @@ FieldSolverMultigrid::parseMultigridSettings()
   else if (str == "multi_color") {
     m_multigridRelaxMethod = MFHelmholtzOp::Smoother::GauSaiMultiColor;
   }
+  else if (str == "red_black_deep") {
+    m_multigridRelaxMethod = MFHelmholtzOp::Smoother::GauSaiRedBlackDeep;
+  }
   else {
     MayDay::Error("FieldSolverMultigrid::parseMultigridSettings() - unsupported relaxation method requested");
   }
@@ -167,9 +188,69 @@ FieldSolverMultigrid::parseMultigridSettings()
   if (str == "vcycle") {
     m_multigridType = MultigridType::VCycle;
   }
+  else if (str == "wcycle") {
+    m_multigridType = MultigridType::WCycle;
+  }
+  else if (str == "fcycle") {
+    m_multigridType = MultigridType::FCycle;
+  }
   else {
     MayDay::Error(
-      "FieldSolverMultigrid::parseMultigridSettings - unsupported multigrid cycle type requested. Only vcycle supported for now. ");
+      "FieldSolverMultigrid::parseMultigridSettings - unsupported multigrid cycle type requested. Expected 'vcycle', 'wcycle', or 'fcycle'");
+  }
+
+  // Full multigrid startup and reporting. These are optional.
+  m_multigridFMG       = false;
+  m_multigridFMGCycles = 1;
+  m_multigridReport    = false;
+
+  pp.query("gmg_fmg", m_multigridFMG);
+  pp.query("gmg_fmg_cycles", m_multigridFMGCycles);
+  pp.query("gmg_report", m_multigridReport);
+
+  if (m_multigridFMGCycles < 1) {
+    m_multigridFMGCycles = 1;
+  }
+
+  // Outer Krylov solver, using multigrid as a preconditioner. Optional.
+  str = "none";
+  pp.query("gmg_outer_krylov", str);
+  if (str == "none") {
+    m_outerKrylovType = OuterKrylovType::None;
+  }
+  else if (str == "bicgstab") {
+    m_outerKrylovType = OuterKrylovType::BiCGStab;
+  }
+  else if (str == "cg") {
+    MayDay::Error("FieldSolverMultigrid::parseMultigridSettings - 'cg' is not supported because the multigrid preconditioner is not symmetric");
+  }
+  else {
+    MayDay::Error("FieldSolverMultigrid::parseMultigridSettings - unsupported outer Krylov solver. Expected 'none' or 'bicgstab'");
+  }
+
+  m_krylovMinIterations = 1;
+
+  pp.query("gmg_krylov_min_iter", m_krylovMinIterations);
+
+  if (m_krylovMinIterations < 0) {
+    MayDay::Error("FieldSolverMultigrid::parseMultigridSettings - 'gmg_krylov_min_iter' must be >= 0");
+  }
+
+  // Initial guess predictor and reuse of the convergence metric. Optional.
+  m_predictorOrder     = 0;
+  m_multigridReuseNorm = false;
+
+  pp.query("gmg_predictor", m_predictorOrder);
+  pp.query("gmg_reuse_norm", m_multigridReuseNorm);
+
+  if (m_predictorOrder < 0 || m_predictorOrder > 2) {
+    MayDay::Error("FieldSolverMultigrid::parseMultigridSettings - 'gmg_predictor' must be 0, 1, or 2");
+  }
+
+  // Drop solutions that the predictor no longer needs.
+  while (m_potentialHistory.size() > m_predictorOrder + 1 || (m_predictorOrder == 0 && !m_potentialHistory.empty())) {
+    m_potentialHistory.erase(m_potentialHistory.begin());
+    m_potentialHistoryTimes.erase(m_potentialHistoryTimes.begin());
   }
 
   // No lower than 2.
@@ -257,6 +338,14 @@ FieldSolverMultigrid::solve(MFAMRCellData&       a_phi,
   m_amr->allocate(sigmaByEps0, m_realm, phase::gas, m_nComp);
   CH_STOP(t1);
 
+  // The predictor and the cached convergence metric only apply to the solver's own potential. Other solves (e.g. the multi-RHS solve) can have
+  // entirely different boundary conditions and sources.
+  const bool isPotential = (&a_phi == &m_potential);
+
+  if (isPotential && !a_zeroPhi && m_predictorOrder > 0) {
+    this->predictPotential(a_phi, m_solutionTime);
+  }
+
   // Scale data as appropriate.
   CH_START(t2);
   DataOps::setValue(zero, 0.0);
@@ -303,26 +392,98 @@ FieldSolverMultigrid::solve(MFAMRCellData&       a_phi,
   // This is the residue rho - L(phi)
   const Real phiResid = m_multigridSolver->computeAMRResidual(phi, rhs, finestLevel, 0);
 
-  // This is the residue rho - L(phi=0)
-  const Real zeroResid = m_multigridSolver->computeAMRResidual(zer, rhs, finestLevel, 0);
+  // This is the residue rho - L(phi=0). If we reuse the metric from the previous solve we skip this computation, unless the residual of the
+  // initial guess is larger than the previous metric (which indicates that the problem has changed too much for the metric to be useful).
+  Real zeroResid;
+
+  const bool reuseNorm = isPotential && !a_zeroPhi && m_multigridReuseNorm && m_multigridZeroResid > 0.0 && phiResid <= m_multigridZeroResid;
+
+  if (reuseNorm) {
+    zeroResid = m_multigridZeroResid;
+  }
+  else {
+    zeroResid = m_multigridSolver->computeAMRResidual(zer, rhs, finestLevel, 0);
+
+    if (isPotential) {
+      m_multigridZeroResid = zeroResid;
+    }
+  }
 
   // Convergence criterion.
   const Real convergedResid = zeroResid * m_multigridExitTolerance;
 
+  m_multigridNumCycles = 0;
+  m_multigridLevelTimes.resize(1 + finestLevel);
+  for (int lvl = 0; lvl <= finestLevel; lvl++) {
+    m_multigridLevelTimes[lvl] = 0.0;
+  }
+
+  const Real startTime = Timer::wallClock();
+
   // If the residue rho - L(phi) is too large then we must get a new solution.
   if (phiResid > convergedResid) {
     m_multigridSolver->m_convergenceMetric = zeroResid;
-    m_multigridSolver->solveNoInitResid(phi, res, rhs, finestLevel, coarsestLevel, a_zeroPhi);
 
-    const int status = m_multigridSolver->m_exitStatus; // 1 => Initial norm sufficiently reduced
-    if (status == 1 || status == 8) {                   // 8 => Norm sufficiently small
-      converged = true;
+    // Full multigrid startup on the first solve after setting up the solver, or when we start from phi = 0.
+    const bool useFMG = m_multigridFMG && (m_multigridNeedsFMG || a_zeroPhi) && finestLevel > 0;
+
+    if (useFMG) {
+      if (a_zeroPhi) {
+        DataOps::setValue(a_phi, 0.0);
+      }
+
+      this->fullMultigridStartup(phi, res, rhs, finestLevel);
+    }
+
+    if (m_outerKrylovType != OuterKrylovType::None) {
+      if (a_zeroPhi && !useFMG) {
+        DataOps::setValue(a_phi, 0.0);
+      }
+
+      converged = this->solveOuterKrylov(a_phi, kappaRhoByEps0, zero, convergedResid);
+    }
+    else if (m_multigridType == MultigridType::FCycle || m_multigridReport) {
+      // V- and W-cycles are driven one cycle at a time when reporting, since AMRMultiGrid does not expose its iteration count.
+      if (a_zeroPhi && !useFMG) {
+        DataOps::setValue(a_phi, 0.0);
+      }
+
+      converged = this->runMultigridCycles(phi, res, rhs, convergedResid, finestLevel);
+    }
+    else {
+      m_multigridSolver->solveNoInitResid(phi, res, rhs, finestLevel, coarsestLevel, a_zeroPhi && !useFMG);
+
+      const int status = m_multigridSolver->m_exitStatus; // 1 => Initial norm sufficiently reduced
+      if (status == 1 || status == 8) {                   // 8 => Norm sufficiently small
+        converged = true;
+      }
     }
   }
   else {
     converged = true;
   }
 
+  m_multigridNeedsFMG = false;
+
+  // Report the solve. The cycle count includes the FMG stages, the preconditioner cycles in the outer Krylov method, and all other cycles,
+  // since these are driven one at a time when reporting. The hierarchy timers cover the FMG stages and the cycles we drive ourselves.
+  if (m_multigridReport) {
+    const Real finalResid = m_multigridSolver->computeAMRResidual(phi, rhs, finestLevel, 0);
+    const Real totalTime  = ParallelOps::max(Timer::wallClock() - startTime);
+
+    pout() << m_className + "::solve - converged = " << converged << ", counted cycles = " << m_multigridNumCycles
+           << ", exit status = " << m_multigridSolver->m_exitStatus << ", initial residual = " << phiResid
+           << ", final residual = " << finalResid << ", time = " << totalTime << endl;
+
+    for (int lvl = 0; lvl <= finestLevel; lvl++) {
+      const Real hierarchyTime = ParallelOps::max(m_multigridLevelTimes[lvl]);
+
+      if (hierarchyTime > 0.0) {
+        pout() << "\thierarchy = [0," << lvl << "], time = " << hierarchyTime << endl;
+      }
+    }
+  }
+
   m_multigridSolver->revert(phi, rhs, finestLevel, 0);
 
   // Coarsen/update ghosts before computing the field.
@@ -331,6 +492,10 @@ FieldSolverMultigrid::solve(MFAMRCellData&       a_phi,
 
   this->computeElectricField(m_electricField, a_phi);
 
+  if (isPotential && converged && m_predictorOrder > 0) {
+    this->storePotentialHistory(a_phi, m_solutionTime);
+  }
+
   // If we are also solving for the saturation charge we get that solution from the factory (it can be a free parameter in the Helmholtz solve).
   if (m_jumpBcType == JumpBCType::SaturationCharge) {
     const EBAMRIVData& factorySigma = m_helmholtzOpFactory->getSigma();
@@ -353,6 +518,15 @@ FieldSolverMultigrid::preRegrid(const int a_lbase, const int a_oldFinestLevel)
 
   FieldSolver::preRegrid(a_lbase, a_oldFinestLevel);
 
+  // Back up the predictor history on the old grids.
+  m_potentialHistoryCache.resize(m_potentialHistory.size());
+  for (int i = 0; i < m_potentialHistory.size(); i++) {
+    m_amr->allocate(m_potentialHistoryCache[i], m_realm, m_nComp);
+    m_amr->copyData(m_potentialHistoryCache[i], m_potentialHistory[i]);
+
+    m_potentialHistory[i].clear();
+  }
+
   m_multigridSolver.freeMem();
   m_helmholtzOpFactory.freeMem();
 }
@@ -367,7 +541,19 @@ FieldSolverMultigrid::regrid(const int a_lmin, const int a_oldFinestLevel, const
 
   FieldSolver::regrid(a_lmin, a_oldFinestLevel, a_newFinestLevel);
 
-  m_isSolverSetup = false;
+  // Remap the predictor history to the new grids.
+  const EBCoarseToFineInterp::Type interpType = m_regridSlopes ? EBCoarseToFineInterp::Type::ConservativeMinMod
+                                                               : EBCoarseToFineInterp::Type::ConservativePWC;
+
+  for (int i = 0; i < m_potentialHistory.size(); i++) {
+    m_amr->allocate(m_potentialHistory[i], m_realm, m_nComp);
+    m_amr->interpToNewGrids(m_potentialHistory[i], m_potentialHistoryCache[i], a_lmin, a_oldFinestLevel, a_newFinestLevel, interpType);
+  }
+
+  m_potentialHistoryCache.clear();
+
+  m_isSolverSetup      = false;
+  m_multigridZeroResid = -1.0;
 }
 
 void
@@ -407,7 +593,8 @@ FieldSolverMultigrid::setupSolver()
   this->setupHelmholtzFactory(); // Set up the operator factory
   this->setupMultigrid();        // Set up the AMR multigrid solver
 
-  m_isSolverSetup = true;
+  m_isSolverSetup     = true;
+  m_multigridNeedsFMG = true;
 }
 
 void
@@ -696,7 +883,53 @@ FieldSolverMultigrid::setupMultigrid()
   }
   }
 
-  // Select the multigrid type. Again, the user will have specified this when parseMultigridSettings was called.
+  // AMRMultiGrid requires the finest level and the coarsest domain.
+  const int           finestLevel    = m_amr->getFinestLevel();
+  const ProblemDomain coarsestDomain = m_amr->getDomains()[0];
+
+  // Define the Chombo multigrid solver. The cycle type and number of iterations are set in setMultigridIterations.
+  m_multigridSolver = RefCountedPtr<AMRMultiGrid<LevelData<MFCellFAB>>>(new AMRMultiGrid<LevelData<MFCellFAB>>);
+  m_multigridSolver->define(coarsestDomain, *m_helmholtzOpFactory, bottomSolver, 1 + finestLevel);
+
+  this->setMultigridIterations(m_multigridMinIterations, m_multigridMaxIterations);
+
+  // Multigrid verbosity, in case user wants to see convergence rates etc.
+  m_multigridSolver->m_verbosity = m_multigridVerbosity;
+
+  // Create some dummy storage for multigrid initialization. This is needed because
+  // AMRMultiGrid must allocate the operators.
+  MFAMRCellData dummy1;
+  MFAMRCellData dummy2;
+
+  m_amr->allocate(dummy1, m_realm, m_nComp);
+  m_amr->allocate(dummy2, m_realm, m_nComp);
+
+  DataOps::setValue(dummy1, 0.0);
+  DataOps::setValue(dummy2, 0.0);
+
+  // Aliasing because AMRMultigrid@Chombo is not too clever when it comes to smart pointers.
+  Vector<LevelData<MFCellFAB>*> phi;
+  Vector<LevelData<MFCellFAB>*> rhs;
+
+  m_amr->alias(phi, dummy1);
+  m_amr->alias(rhs, dummy2);
+
+  // Init the solver. This instantiates the all the operators in AMRMultiGrid so we can just call "solve"
+  m_multigridSolver->init(phi, rhs, finestLevel, 0);
+}
+
+void
+FieldSolverMultigrid::setMultigridIterations(const int a_minIter, const int a_maxIter)
+{
+  CH_TIME("FieldSolverMultigrid::setMultigridIterations(int, int)");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolverMultigrid::setMultigridIterations(int, int)" << endl;
+  }
+
+  CH_assert(!m_multigridSolver.isNull());
+
+  // Select the multigrid type. The number is the number of coarse-grid corrections in AMRMultiGrid. F-cycles are done as V-cycles on
+  // successively finer AMR hierarchies, see runMultigridCycles.
   int gmgType;
   switch (m_multigridType) {
   case MultigridType::VCycle: {
@@ -709,55 +942,559 @@ FieldSolverMultigrid::setupMultigrid()
 
     break;
   }
+  case MultigridType::FCycle: {
+    gmgType = 1;
+
+    break;
+  }
   default: {
-    MayDay::Error("FieldSolverMultigrid::setupMultigrid - logic bust in multigrid type selection");
+    MayDay::Error("FieldSolverMultigrid::setMultigridIterations - logic bust in multigrid type selection");
 
     break;
   }
   }
 
-  // AMRMultiGrid requires the finest level and the coarsest domain.
-  const int           finestLevel    = m_amr->getFinestLevel();
-  const ProblemDomain coarsestDomain = m_amr->getDomains()[0];
-
-  // Define the Chombo multigrid solver
-  m_multigridSolver = RefCountedPtr<AMRMultiGrid<LevelData<MFCellFAB>>>(new AMRMultiGrid<LevelData<MFCellFAB>>);
-  m_multigridSolver->define(coarsestDomain, *m_helmholtzOpFactory, bottomSolver, 1 + finestLevel);
   m_multigridSolver->setSolverParameters(m_multigridPreSmooth,
                                          m_multigridPostSmooth,
                                          m_multigridBottomSmooth,
                                          gmgType,
-                                         m_multigridMaxIterations,
+                                         a_maxIter,
                                          m_multigridExitTolerance,
                                          m_multigridExitHang,
                                          1.E-99);
 
   // Minimum number of iterations.
-  m_multigridSolver->m_imin = m_multigridMinIterations;
+  m_multigridSolver->m_imin = a_minIter;
+}
 
-  // Multigrid verbosity, in case user wants to see convergence rates etc.
-  m_multigridSolver->m_verbosity = m_multigridVerbosity;
+void
+FieldSolverMultigrid::fullMultigridStartup(Vector<LevelData<MFCellFAB>*>&       a_phi,
+                                           Vector<LevelData<MFCellFAB>*>&       a_res,
+                                           const Vector<LevelData<MFCellFAB>*>& a_rhs,
+                                           const int                            a_finestLevel)
+{
+  CH_TIME("FieldSolverMultigrid::fullMultigridStartup");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolverMultigrid::fullMultigridStartup" << endl;
+  }
 
-  // Create some dummy storage for multigrid initialization. This is needed because
-  // AMRMultiGrid must allocate the operators.
-  MFAMRCellData dummy1;
-  MFAMRCellData dummy2;
+  // TLDR: This is FMG in correction form. We solve on the coarsest AMR level first and then on the composite hierarchies [0,l] for
+  //       l = 1,2,... Before solving on [0,l] we add the interpolated change in the level l-1 solution to level l. If we started from
+  //       phi = 0 this is the standard FMG, and otherwise we keep the fine-level detail in the initial guess.
 
-  m_amr->allocate(dummy1, m_realm, m_nComp);
-  m_amr->allocate(dummy2, m_realm, m_nComp);
+  Vector<AMRLevelOp<LevelData<MFCellFAB>>*>& operatorsAMR = m_multigridSolver->getAMROperators();
 
-  DataOps::setValue(dummy1, 0.0);
-  DataOps::setValue(dummy2, 0.0);
+  // Storage for the initial solution and the change in the solution on the coarser level.
+  MFAMRCellData phiOld;
+  MFAMRCellData phiCorr;
 
-  // Aliasing because AMRMultigrid@Chombo is not too clever when it comes to smart pointers.
-  Vector<LevelData<MFCellFAB>*> phi;
+  m_amr->allocate(phiOld, m_realm, m_nComp);
+  m_amr->allocate(phiCorr, m_realm, m_nComp);
+
+  Vector<LevelData<MFCellFAB>*> old;
+  Vector<LevelData<MFCellFAB>*> cor;
+
+  m_amr->alias(old, phiOld);
+  m_amr->alias(cor, phiCorr);
+
+  for (int lvl = 0; lvl <= a_finestLevel; lvl++) {
+    operatorsAMR[lvl]->assign(*old[lvl], *a_phi[lvl]);
+  }
+
+  // Each call to AMRMultiGrid does exactly one cycle, so that we can stop a stage once it has converged and count the cycles
+  // that were actually done.
+  this->setMultigridIterations(1, 1);
+
+  for (int lvl = 0; lvl < a_finestLevel; lvl++) {
+    const Real startTime = Timer::wallClock();
+
+    // Interpolate the change in the solution on the coarser level.
+    if (lvl > 0) {
+      operatorsAMR[lvl - 1]->assign(*cor[lvl - 1], *a_phi[lvl - 1]);
+      operatorsAMR[lvl - 1]->incr(*cor[lvl - 1], *old[lvl - 1], -1.0);
+
+      cor[lvl - 1]->exchange();
+
+      operatorsAMR[lvl]->AMRProlong(*a_phi[lvl], *cor[lvl - 1]);
+    }
+
+    for (int icycle = 0; icycle < m_multigridFMGCycles; icycle++) {
+      m_multigridSolver->solveNoInitResid(a_phi, a_res, a_rhs, lvl, 0, false);
+
+      m_multigridNumCycles++;
+
+      // Bit 1 => residual on this hierarchy reduced below the tolerance, bit 8 => residual below the absolute threshold.
+      if ((m_multigridSolver->m_exitStatus & (1 | 8)) != 0) {
+        break;
+      }
+    }
+
+    m_multigridLevelTimes[lvl] += Timer::wallClock() - startTime;
+  }
+
+  // Finally, interpolate the change onto the finest level. The solve on the full hierarchy is done by the caller.
+  operatorsAMR[a_finestLevel - 1]->assign(*cor[a_finestLevel - 1], *a_phi[a_finestLevel - 1]);
+  operatorsAMR[a_finestLevel - 1]->incr(*cor[a_finestLevel - 1], *old[a_finestLevel - 1], -1.0);
+
+  cor[a_finestLevel - 1]->exchange();
+
+  operatorsAMR[a_finestLevel]->AMRProlong(*a_phi[a_finestLevel], *cor[a_finestLevel - 1]);
+
+  this->setMultigridIterations(m_multigridMinIterations, m_multigridMaxIterations);
+}
+
+bool
+FieldSolverMultigrid::runMultigridCycles(Vector<LevelData<MFCellFAB>*>&       a_phi,
+                                         Vector<LevelData<MFCellFAB>*>&       a_res,
+                                         const Vector<LevelData<MFCellFAB>*>& a_rhs,
+                                         const Real                           a_convergedResid,
+                                         const int                            a_finestLevel)
+{
+  CH_TIME("FieldSolverMultigrid::runMultigridCycles");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolverMultigrid::runMultigridCycles" << endl;
+  }
+
+  // TLDR: We drive the iterations ourselves and let AMRMultiGrid do exactly one cycle per call. For F-cycles each iteration does one cycle
+  //       on each of the composite hierarchies [0,0], [0,1], ..., [0,finestLevel]. For V- and W-cycles each iteration is one cycle on
+  //       [0,finestLevel]. The exit criteria are the same as in AMRMultiGrid.
+  const int firstHierarchy = (m_multigridType == MultigridType::FCycle) ? 0 : a_finestLevel;
+
+  this->setMultigridIterations(1, 1);
+
+  Real resid = m_multigridSolver->computeAMRResidual(a_phi, a_rhs, a_finestLevel, 0);
+
+  int iter = 0;
+  while ((iter < m_multigridMaxIterations && resid > a_convergedResid) || iter < m_multigridMinIterations) {
+    for (int lvl = firstHierarchy; lvl <= a_finestLevel; lvl++) {
+      const Real startTime = Timer::wallClock();
+
+      m_multigridSolver->solveNoInitResid(a_phi, a_res, a_rhs, lvl, 0, false);
+
+      m_multigridLevelTimes[lvl] += Timer::wallClock() - startTime;
+    }
+
+    iter++;
+    m_multigridNumCycles++;
+
+    const Real newResid = m_multigridSolver->computeAMRResidual(a_phi, a_rhs, a_finestLevel, 0);
+
+    if (m_multigridVerbosity > 0) {
+      pout() << m_className + "::runMultigridCycles - iter = " << iter << ", residual = " << newResid << endl;
+    }
+
+    // Exit if the solver hangs.
+    const bool hang = newResid > (1.0 - m_multigridExitHang) * resid;
+
+    resid = newResid;
+
+    if (hang && iter >= m_multigridMinIterations) {
+      break;
+    }
+  }
+
+  this->setMultigridIterations(m_multigridMinIterations, m_multigridMaxIterations);
+
+  return resid <= a_convergedResid;
+}
+
+bool
+FieldSolverMultigrid::predictPotential(MFAMRCellData& a_phi, const Real a_time) const
+{
+  CH_TIME("FieldSolverMultigrid::predictPotential(MFAMRCellData, Real)");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolverMultigrid::predictPotential(MFAMRCellData, Real)" << endl;
+  }
+
+  CH_assert(m_potentialHistory.size() == m_potentialHistoryTimes.size());
+
+  // TLDR: We extrapolate phi(t) = sum_k w_k * phi_k where w_k are the Lagrange weights for the (up to) m_predictorOrder + 1 most recent
+  //       solutions. With one solution this is just a copy of the previous solution.
+  const int numHistory = m_potentialHistory.size();
+
+  if (numHistory == 0 || a_time <= m_potentialHistoryTimes.back()) {
+    return false;
+  }
+
+  const int numPoints = std::min(numHistory, m_predictorOrder + 1);
+  const int first     = numHistory - numPoints;
+
+  DataOps::setValue(a_phi, 0.0);
+
+  for (int k = first; k < numHistory; k++) {
+    Real weight = 1.0;
+
+    for (int j = first; j < numHistory; j++) {
+      if (j != k) {
+        weight *= (a_time - m_potentialHistoryTimes[j]) / (m_potentialHistoryTimes[k] - m_potentialHistoryTimes[j]);
+      }
+    }
+
+    DataOps::incr(a_phi, m_potentialHistory[k], weight);
+  }
+
+  return true;
+}
+
+void
+FieldSolverMultigrid::storePotentialHistory(const MFAMRCellData& a_phi, const Real a_time)
+{
+  CH_TIME("FieldSolverMultigrid::storePotentialHistory(MFAMRCellData, Real)");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolverMultigrid::storePotentialHistory(MFAMRCellData, Real)" << endl;
+  }
+
+  // Discard solutions at a_time or later. These occur when the solver is called several times at the same time, or when a time step
+  // was rejected.
+  while (!m_potentialHistoryTimes.empty() && m_potentialHistoryTimes.back() >= a_time) {
+    m_potentialHistory.pop_back();
+    m_potentialHistoryTimes.pop_back();
+  }
+
+  // Drop the oldest solutions if the history is full.
+  const int maxHistory = m_predictorOrder + 1;
+
+  if (m_potentialHistory.size() >= maxHistory) {
+    m_potentialHistory.erase(m_potentialHistory.begin(), m_potentialHistory.end() - (maxHistory - 1));
+    m_potentialHistoryTimes.erase(m_potentialHistoryTimes.begin(), m_potentialHistoryTimes.end() - (maxHistory - 1));
+  }
+
+  m_potentialHistory.emplace_back();
+  m_potentialHistoryTimes.emplace_back(a_time);
+
+  m_amr->allocate(m_potentialHistory.back(), m_realm, m_nComp);
+
+  DataOps::copy(m_potentialHistory.back(), a_phi);
+}
+
+bool
+FieldSolverMultigrid::solveOuterKrylov(MFAMRCellData& a_phi,
+                                       MFAMRCellData& a_rhs,
+                                       MFAMRCellData& a_zero,
+                                       const Real     a_convergedResid)
+{
+  CH_TIME("FieldSolverMultigrid::solveOuterKrylov");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolverMultigrid::solveOuterKrylov" << endl;
+  }
+
+  // TLDR: This is right-preconditioned BiCGStab on the composite AMR hierarchy, solving L(e) = rhs - L(phi) with the
+  //       homogeneous operator. The correction is added directly to a_phi. One multigrid cycle is the preconditioner. We monitor the max-norm of
+  //       the recursively updated residual, and confirm convergence using the actual residual.
+
+  const int finestLevel = m_amr->getFinestLevel();
+
+  MFAMRCellData r;
+  MFAMRCellData rHat;
+  MFAMRCellData p;
+  MFAMRCellData v;
+  MFAMRCellData z;
+  MFAMRCellData t;
+  MFAMRCellData bcTerm;
+  MFAMRCellData temp;
+  MFAMRCellData mgRes;
+
+  m_amr->allocate(r, m_realm, m_nComp);
+  m_amr->allocate(rHat, m_realm, m_nComp);
+  m_amr->allocate(p, m_realm, m_nComp);
+  m_amr->allocate(v, m_realm, m_nComp);
+  m_amr->allocate(z, m_realm, m_nComp);
+  m_amr->allocate(t, m_realm, m_nComp);
+  m_amr->allocate(bcTerm, m_realm, m_nComp);
+  m_amr->allocate(temp, m_realm, m_nComp);
+  m_amr->allocate(mgRes, m_realm, m_nComp);
+
+  Vector<LevelData<MFCellFAB>*> phiPtr;
+  Vector<LevelData<MFCellFAB>*> rhsPtr;
+  Vector<LevelData<MFCellFAB>*> zeroPtr;
+  Vector<LevelData<MFCellFAB>*> bcTermPtr;
+  Vector<LevelData<MFCellFAB>*> tempPtr;
+  Vector<LevelData<MFCellFAB>*> pPtr;
+  Vector<LevelData<MFCellFAB>*> vPtr;
+  Vector<LevelData<MFCellFAB>*> zPtr;
+  Vector<LevelData<MFCellFAB>*> tPtr;
+
+  m_amr->alias(phiPtr, a_phi);
+  m_amr->alias(rhsPtr, a_rhs);
+  m_amr->alias(zeroPtr, a_zero);
+  m_amr->alias(bcTermPtr, bcTerm);
+  m_amr->alias(tempPtr, temp);
+  m_amr->alias(pPtr, p);
+  m_amr->alias(vPtr, v);
+  m_amr->alias(zPtr, z);
+  m_amr->alias(tPtr, t);
+
+  // bcTerm = L(0) is the contribution from inhomogeneous boundary conditions, and r = rhs - L(phi) is the initial residual.
+  m_multigridSolver->computeAMROperator(bcTermPtr, zeroPtr, finestLevel, 0, false);
+  m_multigridSolver->computeAMROperator(tempPtr, phiPtr, finestLevel, 0, false);
+
+  DataOps::copy(r, a_rhs);
+  DataOps::incr(r, temp, -1.0);
+
+  // The preconditioner is exactly one cycle.
+  this->setMultigridIterations(1, 1);
+
+  constexpr Real tiny = std::numeric_limits<Real>::min();
+
+  int  iter      = 0;
+  bool converged = false;
+
+  // Convergence check. We use the recursive residual but confirm with the actual residual.
+  auto isConverged = [&](const MFAMRCellData& a_residual) -> bool {
+    const Real resid = this->compositeMaxNorm(a_residual);
+
+    if (m_multigridVerbosity > 0) {
+      pout() << m_className + "::solveOuterKrylov - iter = " << iter << ", residual = " << resid << endl;
+    }
+
+    bool ret = false;
+
+    if (resid <= a_convergedResid && iter >= m_krylovMinIterations) {
+      ret = m_multigridSolver->computeAMRResidual(phiPtr, rhsPtr, finestLevel, 0) <= a_convergedResid;
+    }
+
+    return ret;
+  };
+
+  switch (m_outerKrylovType) {
+  case OuterKrylovType::BiCGStab: {
+    Real rhoOld = 1.0;
+    Real alpha  = 1.0;
+    Real omega  = 1.0;
+
+    DataOps::copy(rHat, r);
+    DataOps::setValue(p, 0.0);
+    DataOps::setValue(v, 0.0);
+
+    while (iter < m_multigridMaxIterations && !converged) {
+      const Real rho = this->compositeDotProduct(rHat, r);
+
+      if (std::abs(rho) < tiny) {
+        break;
+      }
+
+      // p = r + beta * (p - omega * v)
+      const Real beta = (rho / rhoOld) * (alpha / omega);
+
+      DataOps::incr(p, v, -omega);
+      DataOps::scale(p, beta);
+      DataOps::incr(p, r, 1.0);
+
+      // z = M^-1 p and v = L(z)
+      this->applyMultigridPreconditioner(z, p, bcTerm, temp, mgRes);
+      m_multigridSolver->computeAMROperator(vPtr, zPtr, finestLevel, 0, true);
+
+      const Real rHatV = this->compositeDotProduct(rHat, v);
+
+      if (std::abs(rHatV) < tiny) {
+        break;
+      }
+
+      alpha = rho / rHatV;
+
+      // phi = phi + alpha * z and s = r - alpha * v. We store s in r.
+      DataOps::incr(a_phi, z, alpha);
+      DataOps::incr(r, v, -alpha);
+
+      iter++;
+
+      converged = isConverged(r);
+      if (converged) {
+        break;
+      }
+
+      // z = M^-1 s and t = L(z)
+      this->applyMultigridPreconditioner(z, r, bcTerm, temp, mgRes);
+      m_multigridSolver->computeAMROperator(tPtr, zPtr, finestLevel, 0, true);
+
+      const Real tt = this->compositeDotProduct(t, t);
+
+      omega = (tt > tiny) ? this->compositeDotProduct(t, r) / tt : 0.0;
+
+      // phi = phi + omega * z and r = s - omega * t
+      DataOps::incr(a_phi, z, omega);
+      DataOps::incr(r, t, -omega);
+
+      converged = isConverged(r);
+
+      rhoOld = rho;
+
+      if (std::abs(omega) < tiny) {
+        break;
+      }
+    }
+
+    break;
+  }
+  default: {
+    MayDay::Error("FieldSolverMultigrid::solveOuterKrylov - logic bust");
+
+    break;
+  }
+  }
+
+  this->setMultigridIterations(m_multigridMinIterations, m_multigridMaxIterations);
+
+  return converged;
+}
+
+void
+FieldSolverMultigrid::applyMultigridPreconditioner(MFAMRCellData&       a_z,
+                                                   const MFAMRCellData& a_r,
+                                                   const MFAMRCellData& a_bcTerm,
+                                                   MFAMRCellData&       a_temp,
+                                                   MFAMRCellData&       a_res)
+{
+  CH_TIME("FieldSolverMultigrid::applyMultigridPreconditioner");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolverMultigrid::applyMultigridPreconditioner" << endl;
+  }
+
+  // TLDR: AMRMultiGrid computes the initial residual with the inhomogeneous operator, which gives a_temp - L(0) when starting from zero. We
+  //       want the residual to be a_r, so we use a_temp = a_r + L(0). The cycle is then a linear function of a_r.
+  DataOps::copy(a_temp, a_r);
+  DataOps::incr(a_temp, a_bcTerm, 1.0);
+  DataOps::setValue(a_z, 0.0);
+
+  Vector<LevelData<MFCellFAB>*> z;
   Vector<LevelData<MFCellFAB>*> rhs;
+  Vector<LevelData<MFCellFAB>*> res;
 
-  m_amr->alias(phi, dummy1);
-  m_amr->alias(rhs, dummy2);
+  m_amr->alias(z, a_z);
+  m_amr->alias(rhs, a_temp);
+  m_amr->alias(res, a_res);
 
-  // Init the solver. This instantiates the all the operators in AMRMultiGrid so we can just call "solve"
-  m_multigridSolver->init(phi, rhs, finestLevel, 0);
+  m_multigridSolver->solveNoInitResid(z, res, rhs, m_amr->getFinestLevel(), 0, true);
+
+  m_multigridNumCycles++;
+}
+
+Real
+FieldSolverMultigrid::compositeDotProduct(const MFAMRCellData& a_x, const MFAMRCellData& a_y) const noexcept
+{
+  CH_TIME("FieldSolverMultigrid::compositeDotProduct");
+
+  // TLDR: This computes sum(kappa * dV * x * y) over the valid cells, with dV normalized by the coarsest-level cell volume. Cells covered by
+  //       a finer level are not included.
+
+  const AMRMask&      validCells = m_amr->getValidCells(m_realm);
+  const Vector<Real>& dx         = m_amr->getDx();
+
+  Real sum = 0.0;
+
+  for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
+    const DisjointBoxLayout& dbl  = m_amr->getGrids(m_realm)[lvl];
+    const DataIterator&      dit  = dbl.dataIterator();
+    const int                nbox = dit.size();
+
+    const Real dV = std::pow(dx[lvl] / dx[0], SpaceDim);
+
+    Real levelSum = 0.0;
+
+#pragma omp parallel for schedule(runtime) reduction(+ : levelSum)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex&     din     = dit[mybox];
+      const Box            cellBox = dbl[din];
+      const BaseFab<bool>& valid   = (*validCells[lvl])[din];
+
+      for (int i = 0; i < (*a_x[lvl])[din].numPhases(); i++) {
+        const EBCellFAB& X = (*a_x[lvl])[din].getPhase(i);
+        const EBCellFAB& Y = (*a_y[lvl])[din].getPhase(i);
+
+        const EBISBox& ebisbox = X.getEBISBox();
+
+        if (!ebisbox.isAllCovered()) {
+          const FArrayBox& regX = X.getFArrayBox();
+          const FArrayBox& regY = Y.getFArrayBox();
+
+          auto regularKernel = [&](const IntVect& iv) -> void {
+            if (valid(iv, 0) && ebisbox.isRegular(iv)) {
+              levelSum += regX(iv, m_comp) * regY(iv, m_comp);
+            }
+          };
+
+          auto irregularKernel = [&](const VolIndex& vof) -> void {
+            if (valid(vof.gridIndex(), 0)) {
+              levelSum += ebisbox.volFrac(vof) * X(vof, m_comp) * Y(vof, m_comp);
+            }
+          };
+
+          VoFIterator vofit(ebisbox.getIrregIVS(cellBox), ebisbox.getEBGraph());
+
+          BoxLoops::loop(cellBox, regularKernel);
+          BoxLoops::loop(vofit, irregularKernel);
+        }
+      }
+    }
+
+    sum += dV * levelSum;
+  }
+
+  return ParallelOps::sum(sum);
+}
+
+Real
+FieldSolverMultigrid::compositeMaxNorm(const MFAMRCellData& a_x) const noexcept
+{
+  CH_TIME("FieldSolverMultigrid::compositeMaxNorm");
+
+  const AMRMask& validCells = m_amr->getValidCells(m_realm);
+
+  Real maxNorm = 0.0;
+
+  for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
+    const DisjointBoxLayout& dbl  = m_amr->getGrids(m_realm)[lvl];
+    const DataIterator&      dit  = dbl.dataIterator();
+    const int                nbox = dit.size();
+
+#pragma omp parallel for schedule(runtime) reduction(max : maxNorm)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex&     din     = dit[mybox];
+      const Box            cellBox = dbl[din];
+      const BaseFab<bool>& valid   = (*validCells[lvl])[din];
+
+      for (int i = 0; i < (*a_x[lvl])[din].numPhases(); i++) {
+        const EBCellFAB& X = (*a_x[lvl])[din].getPhase(i);
+
+        const EBISBox& ebisbox = X.getEBISBox();
+
+        if (!ebisbox.isAllCovered()) {
+          const FArrayBox& regX = X.getFArrayBox();
+
+          auto regularKernel = [&](const IntVect& iv) -> void {
+            if (valid(iv, 0) && ebisbox.isRegular(iv)) {
+              maxNorm = std::max(maxNorm, std::abs(regX(iv, m_comp)));
+            }
+          };
+
+          auto irregularKernel = [&](const VolIndex& vof) -> void {
+            if (valid(vof.gridIndex(), 0)) {
+              maxNorm = std::max(maxNorm, std::abs(X(vof, m_comp)));
+            }
+          };
+
+          VoFIterator vofit(ebisbox.getIrregIVS(cellBox), ebisbox.getEBGraph());
+
+          BoxLoops::loop(cellBox, regularKernel);
+          BoxLoops::loop(vofit, irregularKernel);
+        }
+      }
+    }
+  }
+
+  return ParallelOps::max(maxNorm);
+}
+
+int
+FieldSolverMultigrid::getNumMultigridCycles() const noexcept
+{
+  return m_multigridNumCycles;
+}
+
+const Vector<Real>&
+FieldSolverMultigrid::getMultigridLevelTimes() const noexcept
+{
+  return m_multigridLevelTimes;
 }
 
 Vector<long long>
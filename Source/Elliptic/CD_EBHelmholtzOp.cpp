@@ -100,13 +100,21 @@ EBHelmholtzOp::EBHelmholtzOp(const Location::Cell                             a_
   m_doInterpCF = true;
   m_doCoarsen  = true;
   m_doExchange = true;
-  m_refluxFree = false;
-  m_profile    = false;
-  m_interval   = Interval(m_comp, m_comp);
+  m_refluxFree      = false;
+  m_profile         = false;
+  m_overlapExchange = false;
+  m_interval        = Interval(m_comp, m_comp);
+
+  // The communication-avoiding smoother can do one red-black half-sweep per ghost cell layer in phi before it needs to exchange again.
+  m_deepGhost = m_ghostPhi[0];
+  for (int dir = 1; dir < SpaceDim; dir++) {
+    m_deepGhost = std::min(m_deepGhost, m_ghostPhi[dir]);
+  }
 
   ParmParse pp("EBHelmholtzOp");
   pp.query("reflux_free", m_refluxFree);
   pp.query("profile", m_profile);
+  pp.query("overlap_exchange", m_overlapExchange);
 
   m_timer = Timer("EBHelmholtzOp");
 
@@ -285,6 +293,8 @@ EBHelmholtzOp::defineStencils()
   m_vofIterIrreg.define(dbl);
   m_vofIterMulti.define(dbl);
   m_vofIterStenc.define(dbl);
+  m_interiorBoxes.define(dbl);
+  m_shellBoxes.define(dbl);
   m_alphaDiagWeight.define(dbl);
   m_betaDiagWeight.define(dbl);
   m_relaxStencils.define(dbl);
@@ -363,6 +373,28 @@ EBHelmholtzOp::defineStencils()
     m_vofIterMulti[din].define(multiIVS, ebgraph);
     m_vofIterStenc[din].define(stencIVS, ebgraph);
 
+    // Split the grid box into an interior box where the regular stencil does not reach into the ghost cells, and a boundary shell which does. The
+    // shell is built from slabs along each coordinate direction.
+    Box         interiorBox = cellBox;
+    Vector<Box> shellBoxes;
+    for (int dir = 0; dir < SpaceDim && !interiorBox.isEmpty(); dir++) {
+      Box loShell = interiorBox;
+      Box hiShell = interiorBox;
+
+      loShell.setBig(dir, interiorBox.smallEnd(dir));
+      hiShell.setSmall(dir, interiorBox.bigEnd(dir));
+
+      shellBoxes.push_back(loShell);
+      if (interiorBox.size(dir) > 1) {
+        shellBoxes.push_back(hiShell);
+      }
+
+      interiorBox.grow(dir, -1);
+    }
+
+    m_interiorBoxes[din] = interiorBox;
+    m_shellBoxes[din]    = shellBoxes;
+
     for (int dir = 0; dir < SpaceDim; dir++) {
       const IntVectSet loIrreg = irregIVS & m_sideBox.at(std::make_pair(dir, Side::Lo));
       const IntVectSet hiIrreg = irregIVS & m_sideBox.at(std::make_pair(dir, Side::Hi));
@@ -477,6 +509,11 @@ EBHelmholtzOp::defineStencils()
   this->computeDiagWeight();
   this->computeRelaxationCoefficient();
   this->makeAggStencil();
+
+  if (m_smoother == Smoother::GauSaiRedBlackDeep) {
+    this->defineDeepMask();
+    this->computeDeepCoefficients();
+  }
 }
 
 void
@@ -491,6 +528,10 @@ EBHelmholtzOp::setAlphaAndBeta(const Real& a_alpha, const Real& a_beta)
   this->computeDiagWeight();
   this->computeRelaxationCoefficient();
   this->makeAggStencil();
+
+  if (m_smoother == Smoother::GauSaiRedBlackDeep) {
+    this->computeDeepCoefficients();
+  }
 }
 
 void
@@ -1123,31 +1164,67 @@ EBHelmholtzOp::applyOp(LevelData<EBCellFAB>&             a_Lphi,
   // do a local copy, but that can end up being expensive since this is called on every relaxation.
   LevelData<EBCellFAB>& phi = (LevelData<EBCellFAB>&)a_phi;
 
-  if (m_doExchange) {
-    phi.exchange(m_exchangeCopier);
-  }
-
-  if (m_hasCoar && m_doInterpCF) {
-    this->interpolateCF(phi, a_phiCoar, a_homogeneousCFBC);
-  }
-
-  // Apply operator in each kernel.
   const DisjointBoxLayout& dbl = a_Lphi.disjointBoxLayout();
   const DataIterator&      dit = dbl.dataIterator();
 
   const int nbox = dit.size();
+
+  if (m_doExchange && m_overlapExchange) {
+
+    // Split-phase version. Start the exchange, apply the operator in the box interiors while the messages are in flight, and then do the
+    // boundary shells and cut-cells once the ghost cells are available.
+    phi.exchangeBegin(m_exchangeCopier);
+
 #pragma omp parallel for schedule(runtime)
-  for (int mybox = 0; mybox < nbox; mybox++) {
-    const DataIndex& din = dit[mybox];
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      this->applyOpInterior(a_Lphi[din], phi[din], (*m_Acoef)[din], (*m_Bcoef)[din], din);
+    }
+
+    phi.exchangeEnd();
+
+    if (m_hasCoar && m_doInterpCF) {
+      this->interpolateCF(phi, a_phiCoar, a_homogeneousCFBC);
+    }
+
+#pragma omp parallel for schedule(runtime)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      this->applyOpBoundary(a_Lphi[din],
+                            phi[din],
+                            (*m_Acoef)[din],
+                            (*m_Bcoef)[din],
+                            (*m_BcoefIrreg)[din],
+                            dbl[din],
+                            din,
+                            a_homogeneousPhysBC);
+    }
+  }
+  else {
+    if (m_doExchange) {
+      phi.exchange(m_exchangeCopier);
+    }
+
+    if (m_hasCoar && m_doInterpCF) {
+      this->interpolateCF(phi, a_phiCoar, a_homogeneousCFBC);
+    }
+
+    // Apply operator in each kernel.
+#pragma omp parallel for schedule(runtime)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
 
-    this->applyOp(a_Lphi[din],
-                  phi[din],
-                  (*m_Acoef)[din],
-                  (*m_Bcoef)[din],
-                  (*m_BcoefIrreg)[din],
-                  dbl[din],
-                  din,
-                  a_homogeneousPhysBC);
+      this->applyOp(a_Lphi[din],
+                    phi[din],
+                    (*m_Acoef)[din],
+                    (*m_Bcoef)[din],
+                    (*m_BcoefIrreg)[din],
+                    dbl[din],
+                    din,
+                    a_homogeneousPhysBC);
+    }
   }
 }
 
@@ -1204,6 +1281,20 @@ EBHelmholtzOp::applyOpRegular(EBCellFAB&             a_Lphi,
   this->applyDomainFlux(a_phi, a_Bcoef, a_cellBox, a_dit, a_homogeneousPhysBC);
   CH_STOP(t1);
 
+  CH_START(t2);
+  this->applyOpRegularKernel(a_Lphi, a_phi, a_Acoef, a_Bcoef, a_cellBox);
+  CH_STOP(t2);
+}
+
+void
+EBHelmholtzOp::applyOpRegularKernel(EBCellFAB&       a_Lphi,
+                                    const EBCellFAB& a_phi,
+                                    const EBCellFAB& a_Acoef,
+                                    const EBFluxFAB& a_Bcoef,
+                                    const Box&       a_computeBox) const noexcept
+{
+  CH_TIME("EBHelmholtzOp::applyOpRegularKernel");
+
   FArrayBox&       Lphi = a_Lphi.getFArrayBox();
   const FArrayBox& phi  = a_phi.getFArrayBox();
   const FArrayBox& aco  = a_Acoef.getFArrayBox();
@@ -1229,10 +1320,60 @@ EBHelmholtzOp::applyOpRegular(EBCellFAB&             a_Lphi,
                                 );
   };
 
-  // Launch the kernel.
-  CH_START(t2);
-  BoxLoops::loop(a_cellBox, kernel);
-  CH_STOP(t2);
+  BoxLoops::loop(a_computeBox, kernel);
+}
+
+void
+EBHelmholtzOp::applyOpInterior(EBCellFAB&       a_Lphi,
+                               const EBCellFAB& a_phi,
+                               const EBCellFAB& a_Acoef,
+                               const EBFluxFAB& a_Bcoef,
+                               const DataIndex& a_dit) const noexcept
+{
+  CH_TIME("EBHelmholtzOp::applyOpInterior");
+
+  const EBISBox& ebisbox     = m_eblg.getEBISL()[a_dit];
+  const Box&     interiorBox = m_interiorBoxes[a_dit];
+
+  if (!ebisbox.isAllCovered() && !interiorBox.isEmpty()) {
+    this->applyOpRegularKernel(a_Lphi, a_phi, a_Acoef, a_Bcoef, interiorBox);
+  }
+}
+
+void
+EBHelmholtzOp::applyOpBoundary(EBCellFAB&             a_Lphi,
+                               EBCellFAB&             a_phi,
+                               const EBCellFAB&       a_Acoef,
+                               const EBFluxFAB&       a_Bcoef,
+                               const BaseIVFAB<Real>& a_BcoefIrreg,
+                               const Box&             a_cellBox,
+                               const DataIndex&       a_dit,
+                               const bool             a_homogeneousPhysBC) const noexcept
+{
+  CH_TIME("EBHelmholtzOp::applyOpBoundary");
+
+  // TLDR: This does the part of applyOp which needs the ghost cells. We first fill the domain ghost cells and apply the regular stencil in the
+  //       boundary shell of the grid box. The cut-cells are then done with the usual irregular kernel, which overwrites the regular result
+  //       that applyOpInterior might have put in cut-cells in the interior.
+  const EBISBox& ebisbox = m_eblg.getEBISL()[a_dit];
+
+  if (!ebisbox.isAllCovered()) {
+    this->applyDomainFlux(a_phi, a_Bcoef, a_cellBox, a_dit, a_homogeneousPhysBC);
+
+    for (const auto& shellBox : m_shellBoxes[a_dit].stdVector()) {
+      this->applyOpRegularKernel(a_Lphi, a_phi, a_Acoef, a_Bcoef, shellBox);
+    }
+
+    this->applyOpIrregular(a_Lphi,
+                           a_phi,
+                           a_Acoef,
+                           a_Bcoef,
+                           a_BcoefIrreg,
+                           m_alphaDiagWeight[a_dit],
+                           a_cellBox,
+                           a_dit,
+                           a_homogeneousPhysBC);
+  }
 }
 
 void
@@ -1248,77 +1389,90 @@ EBHelmholtzOp::applyDomainFlux(EBCellFAB&       a_phi,
   //       the domain so that centered differences on the edge cells inject said flux. This is a simple trick for enforcing the flux
   //       on the domain edges when we later compute the finite volume Laplacian.
 
-  constexpr Real tol = 1.E-15;
+  FArrayBox& phiFAB = a_phi.getFArrayBox();
 
   for (int dir = 0; dir < SpaceDim; dir++) {
+    this->applyDomainFlux(phiFAB, a_Bcoef[dir].getFArrayBox(), dir, a_cellBox, a_dit, a_homogeneousPhysBC);
+  }
+}
 
-    FArrayBox&       phiFAB = a_phi.getFArrayBox();
-    const FArrayBox& bco    = a_Bcoef[dir].getFArrayBox();
-
-    Box loBox;
-    Box hiBox;
-    int hasLo;
-    int hasHi;
-    EBArith::loHi(loBox, hasLo, hiBox, hasHi, m_eblg.getDomain(), a_cellBox, dir);
+void
+EBHelmholtzOp::applyDomainFlux(FArrayBox&       a_phi,
+                               const FArrayBox& a_Bcoef,
+                               const int        a_dir,
+                               const Box&       a_cellBox,
+                               const DataIndex& a_dit,
+                               const bool       a_homogeneousPhysBC) const noexcept
+{
+  CH_TIME("EBHelmholtzOp::applyDomainFlux(FArrayBox, FArrayBox, int, Box, DataIndex, bool)");
 
-    if (hasLo == 1) {
+  // TLDR: This is the same as the EBCellFAB version but only does one coordinate direction.
 
-      // Fill the domain flux. This might look weird, and we are actually putting the flux in a cell-centered data holder. By this, we implicitly
-      // understand that the flux that is stored in the box is the flux that comes in through the lo side in the coordinate direction we are looking.
-      FArrayBox faceFlux(loBox, m_nComp);
-      m_domainBc->getFaceFlux(faceFlux, phiFAB, bco, dir, Side::Lo, a_dit, a_homogeneousPhysBC);
+  constexpr Real tol = 1.E-15;
 
-      // The EBArith loBox is cell-centered interior box abutting the domain side. We want the box immediately outside the domain.
-      Box ghostBox = loBox;
-      ghostBox.shift(dir, -1);
+  Box loBox;
+  Box hiBox;
+  int hasLo;
+  int hasHi;
+  EBArith::loHi(loBox, hasLo, hiBox, hasHi, m_eblg.getDomain(), a_cellBox, a_dir);
 
-      // This kernel might look weird, but we have designed our BC classes in such a weird way -- they fill boundary fluxes but the fluxes
-      // are stored in a cell-centered box abutting the domain. So, this is just like a "regular" kernel, with the exception of that pesky flux
-      // which physically lives on the face but is computationally stored on the cell.
-      auto kernel = [&](const IntVect& iv) -> void {
-        const Real& B = bco(iv + BASISV(dir), m_comp);
+  if (hasLo == 1) {
 
-        Real scaledFlux;
-        if (std::abs(B) > tol) {
-          scaledFlux = faceFlux(iv + BASISV(dir), m_comp) / B;
-        }
-        else {
-          scaledFlux = 0.0;
-        }
-        phiFAB(iv, m_comp) = phiFAB(iv + BASISV(dir), m_comp) - scaledFlux * m_dx;
-      };
+    // Fill the domain flux. This might look weird, and we are actually putting the flux in a cell-centered data holder. By this, we implicitly
+    // understand that the flux that is stored in the box is the flux that comes in through the lo side in the coordinate direction we are looking.
+    FArrayBox faceFlux(loBox, m_nComp);
+    m_domainBc->getFaceFlux(faceFlux, a_phi, a_Bcoef, a_dir, Side::Lo, a_dit, a_homogeneousPhysBC);
 
-      BoxLoops::loop(ghostBox, kernel);
-    }
+    // The EBArith loBox is cell-centered interior box abutting the domain side. We want the box immediately outside the domain.
+    Box ghostBox = loBox;
+    ghostBox.shift(a_dir, -1);
 
-    if (hasHi == 1) {
-      // Fill the domain flux. This might look weird, and we are actually putting the flux in a cell-centered data holder. By this, we implicitly
-      // understand that the flux that is stored in the box is the flux that comes in through the hi side in the coordinate direction we are looking.
-      FArrayBox faceFlux(hiBox, m_nComp);
-      m_domainBc->getFaceFlux(faceFlux, phiFAB, bco, dir, Side::Hi, a_dit, a_homogeneousPhysBC);
+    // This kernel might look weird, but we have designed our BC classes in such a weird way -- they fill boundary fluxes but the fluxes
+    // are stored in a cell-centered box abutting the domain. So, this is just like a "regular" kernel, with the exception of that pesky flux
+    // which physically lives on the face but is computationally stored on the cell.
+    auto kernel = [&](const IntVect& iv) -> void {
+      const Real& B = a_Bcoef(iv + BASISV(a_dir), m_comp);
 
-      // The EBArith hiBox is cell-centered interior box abutting the domain side. We want the box immediately outside the domain.
-      Box ghostBox = hiBox;
-      ghostBox.shift(dir, 1);
+      Real scaledFlux;
+      if (std::abs(B) > tol) {
+        scaledFlux = faceFlux(iv + BASISV(a_dir), m_comp) / B;
+      }
+      else {
+        scaledFlux = 0.0;
+      }
+      a_phi(iv, m_comp) = a_phi(iv + BASISV(a_dir), m_comp) - scaledFlux * m_dx;
+    };
 
-      // This kernel might look weird, but we have designed our BC classes in such a weird way -- they fill boundary fluxes but the fluxes
-      // are stored in a cell-centered box abutting the domain. So, this is just like a "regular" kernel, with the exception of that pesky flux
-      // which physically lives on the face but is computationally stored on the cell.
-      auto kernel = [&](const IntVect& iv) -> void {
-        const Real& B = bco(iv - BASISV(dir), m_comp);
+    BoxLoops::loop(ghostBox, kernel);
+  }
 
-        Real scaledFlux;
-        if (std::abs(B) > tol) {
-          scaledFlux = faceFlux(iv - BASISV(dir), m_comp) / B;
-        }
-        else {
-          scaledFlux = 0.0;
-        }
-        phiFAB(iv, m_comp) = phiFAB(iv - BASISV(dir), m_comp) + scaledFlux * m_dx;
-      };
+  if (hasHi == 1) {
+    // Fill the domain flux. This might look weird, and we are actually putting the flux in a cell-centered data holder. By this, we implicitly
+    // understand that the flux that is stored in the box is the flux that comes in through the hi side in the coordinate direction we are looking.
+    FArrayBox faceFlux(hiBox, m_nComp);
+    m_domainBc->getFaceFlux(faceFlux, a_phi, a_Bcoef, a_dir, Side::Hi, a_dit, a_homogeneousPhysBC);
+
+    // The EBArith hiBox is cell-centered interior box abutting the domain side. We want the box immediately outside the domain.
+    Box ghostBox = hiBox;
+    ghostBox.shift(a_dir, 1);
+
+    // This kernel might look weird, but we have designed our BC classes in such a weird way -- they fill boundary fluxes but the fluxes
+    // are stored in a cell-centered box abutting the domain. So, this is just like a "regular" kernel, with the exception of that pesky flux
+    // which physically lives on the face but is computationally stored on the cell.
+    auto kernel = [&](const IntVect& iv) -> void {
+      const Real& B = a_Bcoef(iv - BASISV(a_dir), m_comp);
+
+      Real scaledFlux;
+      if (std::abs(B) > tol) {
+        scaledFlux = faceFlux(iv - BASISV(a_dir), m_comp) / B;
+      }
+      else {
+        scaledFlux = 0.0;
+      }
+      a_phi(iv, m_comp) = a_phi(iv - BASISV(a_dir), m_comp) + scaledFlux * m_dx;
+    };
 
-      BoxLoops::loop(ghostBox, kernel);
-    }
+    BoxLoops::loop(ghostBox, kernel);
   }
 }
 
@@ -1603,6 +1757,11 @@ EBHelmholtzOp::relax(LevelData<EBCellFAB>& a_correction, const LevelData<EBCellF
 
     break;
   }
+  case Smoother::GauSaiRedBlackDeep: {
+    this->relaxGSRedBlackDeep(a_correction, a_residual, a_iterations);
+
+    break;
+  }
   default: {
     MayDay::Error("EBHelmholtzOp::relax - bogus relaxation method requested");
 
@@ -1699,26 +1858,62 @@ EBHelmholtzOp::relaxGSRedBlack(LevelData<EBCellFAB>&       a_correction,
 
     // First do "red" cells, then "black" cells. Note that ghost cell interpolation and exchanges are required between the colors.
     for (int redBlack = 0; redBlack <= 1; redBlack++) {
-      if (m_doExchange) {
-        a_correction.exchange(m_exchangeCopier);
+      const int nbox = dit.size();
+
+      if (m_doExchange && m_overlapExchange) {
+
+        // Split-phase version. Compute L(phi) in the box interiors while the ghost cells are exchanged, and then finish the boundary shells,
+        // cut-cells, and the update.
+        a_correction.exchangeBegin(m_exchangeCopier);
+
+#pragma omp parallel for schedule(runtime)
+        for (int mybox = 0; mybox < nbox; mybox++) {
+          const DataIndex& din = dit[mybox];
+
+          this->applyOpInterior(Lcorr[din], a_correction[din], (*m_Acoef)[din], (*m_Bcoef)[din], din);
+        }
+
+        a_correction.exchangeEnd();
+
+        this->homogeneousCFInterp(a_correction);
+
+#pragma omp parallel for schedule(runtime)
+        for (int mybox = 0; mybox < nbox; mybox++) {
+          const DataIndex& din = dit[mybox];
+
+          this->applyOpBoundary(Lcorr[din],
+                                a_correction[din],
+                                (*m_Acoef)[din],
+                                (*m_Bcoef)[din],
+                                (*m_BcoefIrreg)[din],
+                                dbl[din],
+                                din,
+                                true);
+
+          this->gauSaiRedBlackUpdate(a_correction[din], Lcorr[din], a_residual[din], dbl[din], din, redBlack);
+        }
       }
+      else {
+        if (m_doExchange) {
+          a_correction.exchange(m_exchangeCopier);
+        }
 
-      this->homogeneousCFInterp(a_correction);
+        this->homogeneousCFInterp(a_correction);
 
-      const int nbox = dit.size();
 #pragma omp parallel for schedule(runtime)
-      for (int mybox = 0; mybox < nbox; mybox++) {
-        const DataIndex& din = dit[mybox];
+        for (int mybox = 0; mybox < nbox; mybox++) {
+          const DataIndex& din = dit[mybox];
 
-        this->gauSaiRedBlackKernel(Lcorr[din],
-                                   a_correction[din],
-                                   a_residual[din],
-                                   (*m_Acoef)[din],
-                                   (*m_Bcoef)[din],
-                                   (*m_BcoefIrreg)[din],
-                                   dbl[din],
-                                   din,
-                                   redBlack);
+          this->gauSaiRedBlackKernel(Lcorr[din],
+                                     a_correction[din],
+                                     a_residual[din],
+                                     (*m_Acoef)[din],
+                                     (*m_Bcoef)[din],
+                                     (*m_BcoefIrreg)[din],
+                                     dbl[din],
+                                     din,
+                                     redBlack);
+        }
       }
     }
   }
@@ -1735,18 +1930,34 @@ EBHelmholtzOp::gauSaiRedBlackKernel(EBCellFAB&             a_Lcorr,
                                     const DataIndex&       a_dit,
                                     const int&             a_redBlack) const noexcept
 {
-  CH_TIMERS("EBHelmholtzOp::gauSaiRedBlackKernel");
-  CH_TIMER("EBHelmholtzOp::regular_cells", t1);
-  CH_TIMER("EBHelmholtzOp::irregular_cells", t2);
+  CH_TIME("EBHelmholtzOp::gauSaiRedBlackKernel");
 
   // This is the kernel for computing phi^(k+1) = phi^k - (res - L(phi))/|diag(L)| with a red-black pattern. Here, "red" cells are encoded by a_redBlack=0.
 
-  const EBISBox&   ebisbox = m_eblg.getEBISL()[a_dit];
-  const EBCellFAB& relCoef = m_relCoef[a_dit];
+  const EBISBox& ebisbox = m_eblg.getEBISL()[a_dit];
 
   if (!ebisbox.isAllCovered()) {
     this->applyOp(a_Lcorr, a_corr, a_Acoef, a_Bcoef, a_BcoefIrreg, a_cellBox, a_dit, true);
+    this->gauSaiRedBlackUpdate(a_corr, a_Lcorr, a_resid, a_cellBox, a_dit, a_redBlack);
+  }
+}
+
+void
+EBHelmholtzOp::gauSaiRedBlackUpdate(EBCellFAB&       a_corr,
+                                    const EBCellFAB& a_Lcorr,
+                                    const EBCellFAB& a_resid,
+                                    const Box&       a_cellBox,
+                                    const DataIndex& a_dit,
+                                    const int&       a_redBlack) const noexcept
+{
+  CH_TIMERS("EBHelmholtzOp::gauSaiRedBlackUpdate");
+  CH_TIMER("EBHelmholtzOp::regular_cells", t1);
+  CH_TIMER("EBHelmholtzOp::irregular_cells", t2);
+
+  const EBISBox&   ebisbox = m_eblg.getEBISL()[a_dit];
+  const EBCellFAB& relCoef = m_relCoef[a_dit];
 
+  if (!ebisbox.isAllCovered()) {
     BaseFab<Real>&       phiReg  = a_corr.getSingleValuedFAB();
     const BaseFab<Real>& LphiReg = a_Lcorr.getSingleValuedFAB();
     const BaseFab<Real>& rhsReg  = a_resid.getSingleValuedFAB();
@@ -1785,6 +1996,177 @@ EBHelmholtzOp::gauSaiRedBlackKernel(EBCellFAB&             a_Lcorr,
   }
 }
 
+void
+EBHelmholtzOp::relaxGSRedBlackDeep(LevelData<EBCellFAB>&       a_correction,
+                                   const LevelData<EBCellFAB>& a_residual,
+                                   const int                   a_iterations)
+{
+  CH_TIME("EBHelmholtzOp::relaxGSRedBlackDeep(LD<EBCellFAB>, LD<EBCellFAB>, int)");
+
+  // TLDR: This is red-black Gauss-Seidel relaxation where we only exchange ghost cells once every m_deepGhost half-sweeps. Between the exchanges
+  //       we relax the grid box together with a shrinking ring of ghost cells. The half-sweeps following an exchange relax the ghost cells out to a
+  //       distance of m_deepGhost - 1, m_deepGhost - 2, ..., 0 from the grid box. Each half-sweep invalidates the outermost layer of ghost cells, so
+  //       the last half-sweep before the next exchange only relaxes the grid box.
+  //
+  //       Regular ghost cells are relaxed with the same regular stencil as the patch that owns them, so away from cut-cells and refinement
+  //       boundaries this gives the same result as relaxGSRedBlack. Cut-cells are only relaxed by the patch that owns them (with their full stencils).
+  //       Cut-cells and cells next to the refinement boundary that lie in the ghost region retain their exchanged value until the next exchange.
+
+  if (m_deepGhost <= 1) {
+    this->relaxGSRedBlack(a_correction, a_residual, a_iterations);
+
+    return;
+  }
+
+  LevelData<EBCellFAB> Lcorr;
+  this->create(Lcorr, a_residual);
+
+  const DisjointBoxLayout& dbl  = m_eblg.getDBL();
+  const DataIterator&      dit  = dbl.dataIterator();
+  const int                nbox = dit.size();
+
+  // The residual in the ghost cells is needed when we relax the ghost cells. The residual does not change during relaxation so we only exchange it once.
+  LevelData<FArrayBox> residDeep(dbl, m_nComp, (m_deepGhost - 1) * IntVect::Unit);
+
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    residDeep[din].setVal(0.0);
+    residDeep[din].copy(a_residual[din].getSingleValuedFAB(), dbl[din]);
+  }
+
+  residDeep.exchange();
+
+  const int numHalfSweeps = 2 * a_iterations;
+
+  int halfSweep = 0;
+  while (halfSweep < numHalfSweeps) {
+    if (m_doExchange) {
+      a_correction.exchange(m_exchangeCopier);
+    }
+
+    const int numLocal = std::min(m_deepGhost, numHalfSweeps - halfSweep);
+
+    for (int i = 0; i < numLocal; i++, halfSweep++) {
+      const int redBlack  = halfSweep % 2;
+      const int ringWidth = numLocal - 1 - i;
+
+      this->homogeneousCFInterp(a_correction);
+
+#pragma omp parallel for schedule(runtime)
+      for (int mybox = 0; mybox < nbox; mybox++) {
+        const DataIndex& din = dit[mybox];
+
+        this->gauSaiRedBlackDeepKernel(Lcorr[din],
+                                       a_correction[din],
+                                       a_residual[din],
+                                       residDeep[din],
+                                       (*m_Acoef)[din],
+                                       (*m_Bcoef)[din],
+                                       (*m_BcoefIrreg)[din],
+                                       dbl[din],
+                                       din,
+                                       redBlack,
+                                       ringWidth);
+      }
+    }
+  }
+}
+
+void
+EBHelmholtzOp::gauSaiRedBlackDeepKernel(EBCellFAB&             a_Lcorr,
+                                        EBCellFAB&             a_corr,
+                                        const EBCellFAB&       a_resid,
+                                        const FArrayBox&       a_residDeep,
+                                        const EBCellFAB&       a_Acoef,
+                                        const EBFluxFAB&       a_Bcoef,
+                                        const BaseIVFAB<Real>& a_BcoefIrreg,
+                                        const Box&             a_cellBox,
+                                        const DataIndex&       a_dit,
+                                        const int&             a_redBlack,
+                                        const int&             a_ringWidth) const noexcept
+{
+  CH_TIMERS("EBHelmholtzOp::gauSaiRedBlackDeepKernel");
+  CH_TIMER("EBHelmholtzOp::gauSaiRedBlackDeepKernel::grid_box", t1);
+  CH_TIMER("EBHelmholtzOp::gauSaiRedBlackDeepKernel::ghost_cells", t2);
+
+  CH_assert(a_ringWidth < m_deepGhost);
+
+  // TLDR: Relax the grid box exactly like relaxGSRedBlack does. Then relax the regular ghost cells flagged by m_deepMask that lie within a_ringWidth
+  //       of the grid box. We relax the grid box first because the cut-cell stencils may reach beyond the nearest neighbors and should see the same
+  //       values as they would in relaxGSRedBlack. The 5/7 point stencil in the regular ghost cells only reaches cells of the other color, so
+  //       updating them in place is the same as first computing L(phi) and then updating.
+
+  CH_START(t1);
+  this->gauSaiRedBlackKernel(a_Lcorr, a_corr, a_resid, a_Acoef, a_Bcoef, a_BcoefIrreg, a_cellBox, a_dit, a_redBlack);
+  CH_STOP(t1);
+
+  const EBISBox& ebisbox = m_eblg.getEBISL()[a_dit];
+
+  if (a_ringWidth > 0 && !ebisbox.isAllCovered()) {
+    CH_START(t2);
+
+    Box ringBox = grow(a_cellBox, a_ringWidth);
+    ringBox &= m_eblg.getDomain();
+    ringBox &= ebisbox.getRegion();
+
+    FArrayBox&           phi  = a_corr.getFArrayBox();
+    const FArrayBox&     aco  = m_deepAcoef[a_dit];
+    const FluxBox&       bco  = m_deepBcoef[a_dit];
+    const FArrayBox&     rel  = m_deepRelCoef[a_dit];
+    const BaseFab<bool>& mask = m_deepMask[a_dit];
+
+    const FArrayBox& bcoX = bco[0];
+    const FArrayBox& bcoY = bco[1];
+#if CH_SPACEDIM == 3
+    const FArrayBox& bcoZ = bco[2];
+#endif
+
+    // Fill the ghost cells outside the domain so that the domain fluxes are injected into the regular stencil.
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      this->applyDomainFlux(phi, bco[dir], dir, ringBox, a_dit, true);
+    }
+
+    const Real factor = m_beta / (m_dx * m_dx);
+
+    auto kernel = [&](const IntVect& iv) -> void {
+      const bool doThisCell = mask(iv, 0) && std::abs((iv.sum() + a_redBlack) % 2) == 0;
+
+      if (doThisCell) {
+        const Real Lphi = m_alpha * aco(iv, m_comp) * phi(iv, m_comp) +
+                          factor * (bcoX(iv + BASISV(0), m_comp) * (phi(iv + BASISV(0), m_comp) - phi(iv, m_comp)) -
+                                    bcoX(iv, m_comp) * (phi(iv, m_comp) - phi(iv - BASISV(0), m_comp)) +
+                                    bcoY(iv + BASISV(1), m_comp) * (phi(iv + BASISV(1), m_comp) - phi(iv, m_comp)) -
+                                    bcoY(iv, m_comp) * (phi(iv, m_comp) - phi(iv - BASISV(1), m_comp))
+#if CH_SPACEDIM == 3
+                                    + bcoZ(iv + BASISV(2), m_comp) * (phi(iv + BASISV(2), m_comp) - phi(iv, m_comp)) -
+                                    bcoZ(iv, m_comp) * (phi(iv, m_comp) - phi(iv - BASISV(2), m_comp))
+#endif
+                                   );
+
+        phi(iv, m_comp) += rel(iv, m_comp) * (a_residDeep(iv, m_comp) - Lphi);
+      }
+    };
+
+    BoxLoops::loop(ringBox, kernel);
+
+    CH_STOP(t2);
+  }
+}
+
+int
+EBHelmholtzOp::getDeepGhost() const noexcept
+{
+  return m_deepGhost;
+}
+
+bool
+EBHelmholtzOp::getOverlapExchange() const noexcept
+{
+  return m_overlapExchange;
+}
+
 void
 EBHelmholtzOp::relaxGSMultiColor(LevelData<EBCellFAB>&       a_correction,
                                  const LevelData<EBCellFAB>& a_residual,
@@ -2068,6 +2450,123 @@ EBHelmholtzOp::makeAggStencil()
   CH_STOP(t2);
 }
 
+void
+EBHelmholtzOp::defineDeepMask()
+{
+  CH_TIME("EBHelmholtzOp::defineDeepMask()");
+
+  // TLDR: Figure out which ghost cells that GauSaiRedBlackDeep can relax locally. We first flag the cells on this level by exchanging data which
+  //       is one in the valid region and zero elsewhere. A ghost cell can be relaxed if it is a regular cell on this level and all of its neighbors
+  //       are also on this level (or outside the domain). The latter condition excludes the cells next to the refinement boundary, since the
+  //       coarse-fine ghost cells are not updated consistently during the local relaxation.
+
+  if (m_deepGhost <= 1) {
+    return;
+  }
+
+  const DisjointBoxLayout& dbl    = m_eblg.getDBL();
+  const EBISLayout&        ebisl  = m_eblg.getEBISL();
+  const ProblemDomain&     domain = m_eblg.getDomain();
+  const DataIterator&      dit    = dbl.dataIterator();
+
+  const int nbox = dit.size();
+
+  LevelData<FArrayBox> onLevel(dbl, 1, m_deepGhost * IntVect::Unit);
+
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    onLevel[din].setVal(0.0);
+    onLevel[din].setVal(1.0, dbl[din], 0);
+  }
+
+  onLevel.exchange();
+
+  m_deepMask.define(dbl);
+
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    const Box        cellBox = dbl[din];
+    const EBISBox&   ebisbox = ebisl[din];
+    const FArrayBox& flag    = onLevel[din];
+
+    Box ghostBox = grow(cellBox, m_deepGhost - 1);
+    ghostBox &= domain;
+
+    BaseFab<bool>& mask = m_deepMask[din];
+
+    mask.define(ghostBox, 1);
+    mask.setVal(false);
+
+    auto kernel = [&](const IntVect& iv) -> void {
+      bool relaxCell = !cellBox.contains(iv) && flag(iv, 0) > 0.5 && ebisbox.getRegion().contains(iv) && ebisbox.isRegular(iv);
+
+      if (relaxCell) {
+        for (int dir = 0; dir < SpaceDim; dir++) {
+          for (SideIterator sit; sit.ok(); ++sit) {
+            const IntVect ivNeigh = iv + sign(sit()) * BASISV(dir);
+
+            if (domain.contains(ivNeigh) && flag(ivNeigh, 0) < 0.5) {
+              relaxCell = false;
+            }
+          }
+        }
+      }
+
+      mask(iv, 0) = relaxCell;
+    };
+
+    BoxLoops::loop(ghostBox, kernel);
+  }
+}
+
+void
+EBHelmholtzOp::computeDeepCoefficients()
+{
+  CH_TIME("EBHelmholtzOp::computeDeepCoefficients()");
+
+  // TLDR: GauSaiRedBlackDeep needs the operator coefficients and relaxation coefficient in the ghost cells. We copy the regular data into
+  //       ghosted data holders and exchange them. The coefficients do not change during relaxation so this is only done when they are redefined.
+
+  if (m_deepGhost <= 1) {
+    return;
+  }
+
+  const DisjointBoxLayout& dbl   = m_eblg.getDBL();
+  const DataIterator&      dit   = dbl.dataIterator();
+  const IntVect            ghost = (m_deepGhost - 1) * IntVect::Unit;
+
+  m_deepAcoef.define(dbl, m_nComp, ghost);
+  m_deepBcoef.define(dbl, m_nComp, ghost);
+  m_deepRelCoef.define(dbl, m_nComp, ghost);
+
+  const int nbox = dit.size();
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    const Box cellBox = dbl[din];
+
+    m_deepAcoef[din].setVal(0.0);
+    m_deepBcoef[din].setVal(0.0);
+    m_deepRelCoef[din].setVal(0.0);
+
+    m_deepAcoef[din].copy((*m_Acoef)[din].getSingleValuedFAB(), cellBox);
+    m_deepRelCoef[din].copy(m_relCoef[din].getSingleValuedFAB(), cellBox);
+
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      m_deepBcoef[din][dir].copy((*m_Bcoef)[din][dir].getSingleValuedFAB(), surroundingNodes(cellBox, dir));
+    }
+  }
+
+  m_deepAcoef.exchange();
+  m_deepBcoef.exchange();
+  m_deepRelCoef.exchange();
+}
+
 VoFStencil
 EBHelmholtzOp::getFaceCenterFluxStencil(const FaceIndex& a_face, const DataIndex& a_dit) const
 {
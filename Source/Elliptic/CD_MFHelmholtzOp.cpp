@@ -11,6 +11,7 @@
 
 // Std includes
 #include <chrono>
+#include <limits>
 
 // Chombo includes
 #include <ParmParse.H>
@@ -166,6 +167,11 @@ MFHelmholtzOp::MFHelmholtzOp(const Location::Cell                             a_
 
       break;
     }
+    case MFHelmholtzOp::Smoother::GauSaiRedBlackDeep: {
+      ebHelmRelax = EBHelmholtzOp::Smoother::GauSaiRedBlackDeep;
+
+      break;
+    }
     default: {
       MayDay::Error("MFHelmholtzOp::MFHelmholtzOp - unsupported relaxation method requested");
 
@@ -202,6 +208,12 @@ MFHelmholtzOp::MFHelmholtzOp(const Location::Cell                             a_
 
     m_helmOps.insert({iphase, oper});
   }
+
+  // Overlapping the ghost cell exchange with the interior computations is only done if all the phase operators agree on it.
+  m_overlapExchange = !m_helmOps.empty();
+  for (const auto& op : m_helmOps) {
+    m_overlapExchange = m_overlapExchange && op.second->getOverlapExchange();
+  }
 }
 
 MFHelmholtzOp::~MFHelmholtzOp()
@@ -569,6 +581,63 @@ MFHelmholtzOp::applyOp(LevelData<MFCellFAB>&             a_Lphi,
 {
   CH_TIME("MFHelmholtzOp::applyOp");
 
+  const DisjointBoxLayout& dbl = m_mflg.getGrids();
+  const DataIterator&      dit = dbl.dataIterator();
+
+  const int nbox = dit.size();
+
+  if (m_overlapExchange) {
+    LevelData<MFCellFAB>& phi = (LevelData<MFCellFAB>&)a_phi;
+
+    // Split-phase version. The regular stencil is applied in the box interiors while the ghost cells are in transit. The boundary shells and
+    // the cut-cells are done once the ghost cells are available and the jump condition has been matched.
+    phi.exchangeBegin(m_exchangeCopier);
+
+#pragma omp parallel for schedule(runtime)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      for (auto& op : m_helmOps) {
+        const int iphase = op.first;
+
+        EBCellFAB&       Lph   = a_Lphi[din].getPhase(iphase);
+        const EBCellFAB& phPhi = a_phi[din].getPhase(iphase);
+
+        const EBCellFAB& Acoef = (*m_Acoef)[din].getPhase(iphase);
+        const EBFluxFAB& Bcoef = (*m_Bcoef)[din].getPhase(iphase);
+
+        op.second->applyOpInterior(Lph, phPhi, Acoef, Bcoef, din);
+      }
+    }
+
+    phi.exchangeEnd();
+
+    this->interpolateCF(a_phi, a_phiCoar, a_homogeneousCFBC);
+    this->updateJumpBC(a_phi, a_homogeneousPhysBC);
+
+#pragma omp parallel for schedule(runtime)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      const Box cellBox = dbl[din];
+
+      for (auto& op : m_helmOps) {
+        const int iphase = op.first;
+
+        EBCellFAB& Lph   = a_Lphi[din].getPhase(iphase);
+        EBCellFAB& phPhi = phi[din].getPhase(iphase);
+
+        const EBCellFAB&       Acoef      = (*m_Acoef)[din].getPhase(iphase);
+        const EBFluxFAB&       Bcoef      = (*m_Bcoef)[din].getPhase(iphase);
+        const BaseIVFAB<Real>& BcoefIrreg = *(*m_BcoefIrreg)[din].getPhasePtr(iphase);
+
+        op.second->applyOpBoundary(Lph, phPhi, Acoef, Bcoef, BcoefIrreg, cellBox, din, a_homogeneousPhysBC);
+      }
+    }
+
+    return;
+  }
+
   // We need updated ghost cells since both the operator stencil and the "jump" stencil
   // reach into ghost regions.
   this->exchangeGhost(a_phi);
@@ -576,11 +645,6 @@ MFHelmholtzOp::applyOp(LevelData<MFCellFAB>&             a_Lphi,
   this->updateJumpBC(a_phi, a_homogeneousPhysBC);
 
   // Now apply the operator on each patch.
-  const DisjointBoxLayout& dbl = m_mflg.getGrids();
-  const DataIterator&      dit = dbl.dataIterator();
-
-  const int nbox = dit.size();
-
 #pragma omp parallel for schedule(runtime)
   for (int mybox = 0; mybox < nbox; mybox++) {
     const DataIndex& din = dit[mybox];
@@ -735,6 +799,11 @@ MFHelmholtzOp::relax(LevelData<MFCellFAB>& a_correction, const LevelData<MFCellF
 
     break;
   }
+  case Smoother::GauSaiRedBlackDeep: {
+    this->relaxGSRedBlackDeep(a_correction, a_residual, a_iterations);
+
+    break;
+  }
   default: {
     MayDay::Error("MFHelmholtzOp::relax - bogus relaxation method requested");
 
@@ -821,6 +890,58 @@ MFHelmholtzOp::relaxGSRedBlack(LevelData<MFCellFAB>&       a_correction,
   for (int i = 0; i < a_iterations; i++) {
     for (int redBlack = 0; redBlack <= 1; redBlack++) {
 
+      if (m_overlapExchange) {
+
+        // Split-phase version. Compute L(phi) in the box interiors while the ghost cells are in transit, then finish the boundary shells and
+        // cut-cells and do the update.
+        a_correction.exchangeBegin(m_exchangeCopier);
+
+#pragma omp parallel for schedule(runtime)
+        for (int mybox = 0; mybox < nbox; mybox++) {
+          const DataIndex& din = dit[mybox];
+
+          for (auto& op : m_helmOps) {
+            const int iphase = op.first;
+
+            EBCellFAB&       Lph = Lcorr[din].getPhase(iphase);
+            const EBCellFAB& phi = a_correction[din].getPhase(iphase);
+
+            const EBCellFAB& Acoef = (*m_Acoef)[din].getPhase(iphase);
+            const EBFluxFAB& Bcoef = (*m_Bcoef)[din].getPhase(iphase);
+
+            op.second->applyOpInterior(Lph, phi, Acoef, Bcoef, din);
+          }
+        }
+
+        a_correction.exchangeEnd();
+
+        this->interpolateCF(a_correction, nullptr, homogeneousCFBC);
+        this->updateJumpBC(a_correction, homogeneousPhysBC);
+
+#pragma omp parallel for schedule(runtime)
+        for (int mybox = 0; mybox < nbox; mybox++) {
+          const DataIndex& din     = dit[mybox];
+          const Box        cellBox = dbl[din];
+
+          for (auto& op : m_helmOps) {
+            const int iphase = op.first;
+
+            EBCellFAB&       Lph = Lcorr[din].getPhase(iphase);
+            EBCellFAB&       phi = a_correction[din].getPhase(iphase);
+            const EBCellFAB& res = a_residual[din].getPhase(iphase);
+
+            const EBCellFAB&       Acoef      = (*m_Acoef)[din].getPhase(iphase);
+            const EBFluxFAB&       Bcoef      = (*m_Bcoef)[din].getPhase(iphase);
+            const BaseIVFAB<Real>& BcoefIrreg = *(*m_BcoefIrreg)[din].getPhasePtr(iphase);
+
+            op.second->applyOpBoundary(Lph, phi, Acoef, Bcoef, BcoefIrreg, cellBox, din, homogeneousPhysBC);
+            op.second->gauSaiRedBlackUpdate(phi, Lph, res, cellBox, din, redBlack);
+          }
+        }
+
+        continue;
+      }
+
       // Fill/interpolate ghost cells and match the BC.
       this->exchangeGhost(a_correction);
       this->interpolateCF(a_correction, nullptr, homogeneousCFBC);
@@ -850,6 +971,112 @@ MFHelmholtzOp::relaxGSRedBlack(LevelData<MFCellFAB>&       a_correction,
   }
 }
 
+void
+MFHelmholtzOp::relaxGSRedBlackDeep(LevelData<MFCellFAB>&       a_correction,
+                                   const LevelData<MFCellFAB>& a_residual,
+                                   const int                   a_iterations)
+{
+  CH_TIME("MFHelmholtzOp::relaxGSRedBlackDeep");
+
+  // TLDR: This is red-black Gauss-Seidel relaxation where the ghost cells are only exchanged once for several half-sweeps, see
+  //       EBHelmholtzOp::relaxGSRedBlackDeep for the details. Coarse-fine interpolation and matching of the jump condition are patch-local
+  //       operations, so they are still done before each half-sweep.
+
+  int deepGhost = std::numeric_limits<int>::max();
+  for (const auto& op : m_helmOps) {
+    deepGhost = std::min(deepGhost, op.second->getDeepGhost());
+  }
+
+  if (deepGhost <= 1) {
+    this->relaxGSRedBlack(a_correction, a_residual, a_iterations);
+
+    return;
+  }
+
+  LevelData<MFCellFAB> Lcorr;
+  this->create(Lcorr, a_correction);
+
+  const DisjointBoxLayout& dbl = m_mflg.getGrids();
+  const DataIterator&      dit = dbl.dataIterator();
+
+  const int nbox = dit.size();
+
+  constexpr bool homogeneousCFBC   = true;
+  constexpr bool homogeneousPhysBC = true;
+
+  // Residual in the regular cells, with one component per phase. This is exchanged once since the residual does not change during relaxation.
+  LevelData<FArrayBox> residDeep(dbl, m_numPhases, (deepGhost - 1) * IntVect::Unit);
+
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    const Box cellBox = dbl[din];
+
+    residDeep[din].setVal(0.0);
+
+    for (const auto& op : m_helmOps) {
+      const int iphase = op.first;
+
+      residDeep[din].copy(a_residual[din].getPhase(iphase).getSingleValuedFAB(), cellBox, m_comp, cellBox, iphase, 1);
+    }
+  }
+
+  residDeep.exchange();
+
+  const int numHalfSweeps = 2 * a_iterations;
+
+  int halfSweep = 0;
+  while (halfSweep < numHalfSweeps) {
+    this->exchangeGhost(a_correction);
+
+    const int numLocal = std::min(deepGhost, numHalfSweeps - halfSweep);
+
+    for (int i = 0; i < numLocal; i++, halfSweep++) {
+      const int redBlack  = halfSweep % 2;
+      const int ringWidth = numLocal - 1 - i;
+
+      // Interpolate ghost cells and match the BC. Both are local operations.
+      this->interpolateCF(a_correction, nullptr, homogeneousCFBC);
+      this->updateJumpBC(a_correction, homogeneousPhysBC);
+
+      // Do relaxation on each patch.
+#pragma omp parallel for schedule(runtime)
+      for (int mybox = 0; mybox < nbox; mybox++) {
+        const DataIndex& din     = dit[mybox];
+        const Box        cellBox = dbl[din];
+
+        for (auto& op : m_helmOps) {
+          const int iphase = op.first;
+
+          EBCellFAB&       Lph = Lcorr[din].getPhase(iphase);
+          EBCellFAB&       phi = a_correction[din].getPhase(iphase);
+          const EBCellFAB& res = a_residual[din].getPhase(iphase);
+
+          const EBCellFAB&       Acoef      = (*m_Acoef)[din].getPhase(iphase);
+          const EBFluxFAB&       Bcoef      = (*m_Bcoef)[din].getPhase(iphase);
+          const BaseIVFAB<Real>& BcoefIrreg = *(*m_BcoefIrreg)[din].getPhasePtr(iphase);
+
+          // Alias the residual component for this phase.
+          const FArrayBox resDeep(Interval(iphase, iphase), residDeep[din]);
+
+          op.second->gauSaiRedBlackDeepKernel(Lph,
+                                              phi,
+                                              res,
+                                              resDeep,
+                                              Acoef,
+                                              Bcoef,
+                                              BcoefIrreg,
+                                              cellBox,
+                                              din,
+                                              redBlack,
+                                              ringWidth);
+        }
+      }
+    }
+  }
+}
+
 void
 MFHelmholtzOp::relaxGSMultiColor(LevelData<MFCellFAB>&       a_correction,
                                  const LevelData<MFCellFAB>& a_residual,
@@ -64,6 +64,9 @@ ScanShop::ScanShop(const BaseIF&       a_localGeom,
   else if (str == "shuffle") {
     m_boxSorting = BoxSorting::Shuffle;
   }
+  else if (str == "hilbert") {
+    m_boxSorting = BoxSorting::Hilbert;
+  }
 
   m_timer = Timer("ScanShop");
 }
@@ -1211,6 +1211,9 @@ ItoSolver::drawNewParticles(const LevelData<EBCellFAB>& a_particlesPerCell, cons
   // Particle container that we will fill.
   ParticleContainer<ItoParticle>& particles = m_particleContainers.at(WhichContainer::Bulk);
 
+  // Salt for the per-cell random number streams.
+  const uint64_t salt = Random::getStreamSalt(m_name + "::drawNewParticles");
+
   // Go through each patch and instantiate new particles.
   const int nbox = dit.size();
 
@@ -1247,6 +1250,8 @@ ItoSolver::drawNewParticles(const LevelData<EBCellFAB>& a_particlesPerCell, cons
         const RealVect pos   = probLo + (RealVect(iv) + 0.5 * RealVect::Unit) * dx;
         const Real     kappa = 1.0;
 
+        Random::setStream(m_timeStep, Random::getCellID(salt, a_level, iv));
+
         for (const auto& w : weights) {
           const RealVect x = Random::randomPosition(pos, minLo, minHi, centr, norma, dx, kappa);
 
@@ -1283,6 +1288,8 @@ ItoSolver::drawNewParticles(const LevelData<EBCellFAB>& a_particlesPerCell, cons
         const std::vector<long long> weights = ParticleManagement::partitionParticleWeights(llround(ppc(iv)),
                                                                                             (long long)a_newPPC);
 
+        Random::setStream(m_timeStep, Random::getCellID(salt, a_level, iv));
+
         for (const auto& w : weights) {
           const RealVect x = Random::randomPosition(pos, minLo, minHi, cent, norm, dx, kappa);
 
@@ -50,4 +50,93 @@ EBParticleMesh::define(const ProblemDomain& a_domain,
   CH_assert(m_domain.contains(m_region));
 }
 
+void
+EBParticleMesh::deposit(const ParticleSoA&   a_particles,
+                        const int            a_field,
+                        EBCellFAB&           a_rho,
+                        const DepositionType a_depositionType,
+                        const bool           a_forceIrregNGP) const
+{
+  CH_TIME("EBParticleMesh::deposit(ParticleSoA)");
+
+  CH_assert(a_field >= 0 && a_field < a_particles.getNumFields());
+  CH_assert(a_rho.nComp() == 1);
+
+  const size_t numParticles = a_particles.size();
+  const Real*  strength     = a_particles.fieldData(a_field);
+
+  auto forEachParticle = [&](const auto& a_visit) -> void {
+    for (size_t i = 0; i < numParticles; i++) {
+      a_visit(a_particles.getPosition(i), strength[i]);
+    }
+  };
+
+  this->depositKernel(a_rho, forEachParticle, a_depositionType, a_forceIrregNGP);
+}
+
+void
+EBParticleMesh::interpolate(ParticleSoA&         a_particles,
+                            const int            a_firstField,
+                            const EBCellFAB&     a_meshField,
+                            const DepositionType a_interpType,
+                            const bool           a_forceIrregNGP) const
+{
+  CH_TIME("EBParticleMesh::interpolate(ParticleSoA)");
+
+  const int numComp = a_meshField.nComp();
+
+  CH_assert(a_firstField >= 0 && a_firstField + numComp <= a_particles.getNumFields());
+
+  const size_t numParticles = a_particles.size();
+
+  auto forEachParticle = [&](const auto& a_visit) -> void {
+    for (size_t i = 0; i < numParticles; i++) {
+      a_visit(a_particles.getPosition(i), i);
+    }
+  };
+
+  // TLDR: The particle handle is the index in the arrays.
+  auto setField = [&](const size_t a_particle, const Real* a_values) -> void {
+    for (int comp = 0; comp < numComp; comp++) {
+      a_particles.fieldData(a_firstField + comp)[a_particle] = a_values[comp];
+    }
+  };
+
+  this->interpolateKernel<size_t>(a_meshField, forEachParticle, setField, a_interpType, a_forceIrregNGP);
+}
+
+Box
+EBParticleMesh::getValidInterpolationBox(const DepositionType a_interpType) const
+{
+  CH_TIME("EBParticleMesh::getValidInterpolationBox");
+
+  Box validBox = m_domain.domainBox();
+
+  switch (a_interpType) {
+  case DepositionType::NGP: {
+    break;
+  }
+  case DepositionType::CIC: {
+    validBox = grow(validBox, -1);
+
+    break;
+  }
+  case DepositionType::TSC: {
+    validBox = grow(validBox, -2);
+
+    break;
+  }
+  case DepositionType::W4: {
+    validBox = grow(validBox, -3);
+
+    break;
+  }
+  default: {
+    MayDay::Error("EBParticleMesh::getValidInterpolationBox - logic bust");
+  }
+  }
+
+  return validBox;
+}
+
 #include <CD_NamespaceFooter.H>
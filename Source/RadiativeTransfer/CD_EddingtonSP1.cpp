@@ -419,6 +419,9 @@ EddingtonSP1::parseMultigridSettings()
   else if (str == "multi_color") {
     m_multigridRelaxMethod = EBHelmholtzOp::Smoother::GauSaiMultiColor;
   }
+  else if (str == "red_black_deep") {
+    m_multigridRelaxMethod = EBHelmholtzOp::Smoother::GauSaiRedBlackDeep;
+  }
   else {
     MayDay::Error("EddingtonSP1::parseMultigridSettings - unknown relaxation method requested");
   }
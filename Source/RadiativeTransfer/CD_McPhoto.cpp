@@ -13,6 +13,7 @@
 // Std includes
 #include <time.h>
 #include <chrono>
+#include <unordered_map>
 
 // Chombo includes
 #include <ParmParse.H>
@@ -23,6 +24,7 @@
 #include <CD_Location.H>
 #include <CD_McPhoto.H>
 #include <CD_DataOps.H>
+#include <CD_Random.H>
 #include <CD_Units.H>
 #include <CD_PointParticle.H>
 #include <CD_ParticleOps.H>
@@ -102,7 +104,7 @@ McPhoto::advance(const Real a_dt, EBAMRCellData& a_phi, const EBAMRCellData& a_s
 
         const EBAMRCellData& numPhysPhotons = m_amr->slice(numPhysPhotonsPacket, Interval(i, i));
 
-        this->generateComputationalPhotons(m_photons, numPhysPhotons, maxPhotonsPerCell);
+        this->generateComputationalPhotons(m_photons, numPhysPhotons, maxPhotonsPerCell, i);
         this->advancePhotonsInstantaneous(scratchPhotons, m_ebPhotons, m_domainPhotons, m_photons);
 
         // Absorb the bulk photons on the mesh.
@@ -133,7 +135,7 @@ McPhoto::advance(const Real a_dt, EBAMRCellData& a_phi, const EBAMRCellData& a_s
 
       const EBAMRCellData& numPhysPhotons = m_amr->slice(numPhysPhotonsPacket, Interval(i, i));
 
-      this->dirtySamplePhotons(pointParticles, a_phi, numPhysPhotons, maxPhotonsPerCell);
+      this->dirtySamplePhotons(pointParticles, a_phi, numPhysPhotons, maxPhotonsPerCell, i);
     }
   }
 
@@ -906,6 +908,9 @@ McPhoto::computeNumPhysicalPhotons(EBAMRCellData&       a_numPhysPhotonsTotal,
 
   DataOps::setValue(a_numPhysPhotonsTotal, 0.0);
 
+  // Salt for the per-cell random number streams.
+  const uint64_t salt = Random::getStreamSalt(m_name + "::computeNumPhysicalPhotons");
+
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
     const DisjointBoxLayout& dbl   = m_amr->getGrids(m_realm)[lvl];
     const DataIterator&      dit   = dbl.dataIterator();
@@ -934,6 +939,7 @@ McPhoto::computeNumPhysicalPhotons(EBAMRCellData&       a_numPhysPhotonsTotal,
 
       auto regularKernel = [&](const IntVect& iv) -> void {
         if (ebisbox.isRegular(iv) && validCells(iv)) {
+          Random::setStream(m_timeStep, Random::getCellID(salt, lvl, iv));
 
           const size_t numPhysPhotons = this->drawPhotons(sourceReg(iv, 0), vol, a_dt);
           const size_t packetSize     = numPhysPhotons / m_numSamplingPackets;
@@ -952,6 +958,8 @@ McPhoto::computeNumPhysicalPhotons(EBAMRCellData&       a_numPhysPhotonsTotal,
         const IntVect iv = vof.gridIndex();
 
         if (ebisbox.isIrregular(iv) && validCells(iv)) {
+          Random::setStream(m_timeStep, Random::getCellID(salt + vof.cellIndex(), lvl, iv));
+
           const size_t numPhysPhotons = this->drawPhotons(source(vof, 0), vol, a_dt);
           const size_t packetSize     = numPhysPhotons / m_numSamplingPackets;
           const size_t remainder      = numPhysPhotons % m_numSamplingPackets;
@@ -1021,7 +1029,8 @@ McPhoto::drawPhotons(const Real a_source, const Real a_volume, const Real a_dt)
 void
 McPhoto::generateComputationalPhotons(ParticleContainer<Photon>& a_photons,
                                       const EBAMRCellData&       a_numPhysPhotons,
-                                      const size_t               a_maxPhotonsPerCell) const noexcept
+                                      const size_t               a_maxPhotonsPerCell,
+                                      const int                  a_packet) const noexcept
 {
   CH_TIME("McPhoto::generateComputationalPhotons");
   if (m_verbosity > 5) {
@@ -1030,6 +1039,9 @@ McPhoto::generateComputationalPhotons(ParticleContainer<Photon>& a_photons,
 
   CH_assert(a_numPhysPhotons[0]->nComp() == 1);
 
+  // Salt for the per-cell random number streams. Each packet uses different streams.
+  const uint64_t salt = Random::getStreamSalt(m_name + "::generateComputationalPhotons") + (uint64_t)a_packet;
+
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
     const DisjointBoxLayout& dbl    = m_amr->getGrids(m_realm)[lvl];
     const DataIterator&      dit    = dbl.dataIterator();
@@ -1060,6 +1072,8 @@ McPhoto::generateComputationalPhotons(ParticleContainer<Photon>& a_photons,
           const size_t num = numPhysPhotonsReg(iv, 0);
 
           if (num > 0) {
+            Random::setStream(m_timeStep, Random::getCellID(salt, lvl, iv));
+
             const std::vector<size_t> photonWeights = ParticleManagement::partitionParticleWeights(num,
                                                                                                    a_maxPhotonsPerCell);
 
@@ -1090,6 +1104,8 @@ McPhoto::generateComputationalPhotons(ParticleContainer<Photon>& a_photons,
           const size_t num = numPhysPhotons(vof, 0);
 
           if (num > 0) {
+            Random::setStream(m_timeStep, Random::getCellID(salt + vof.cellIndex(), lvl, iv));
+
             const std::vector<size_t> photonWeights = ParticleManagement::partitionParticleWeights(num,
                                                                                                    a_maxPhotonsPerCell);
 
@@ -1133,7 +1149,8 @@ void
 McPhoto::dirtySamplePhotons(ParticleContainer<PointParticle>& a_photons,
                             EBAMRCellData&                    a_phi,
                             const EBAMRCellData&              a_numPhysicalPhotons,
-                            const size_t                      a_maxPhotonsPerCell) const noexcept
+                            const size_t                      a_maxPhotonsPerCell,
+                            const int                         a_packet) const noexcept
 {
   CH_TIME("McPhoto::dirtySamplePhotons");
   if (m_verbosity > 5) {
@@ -1142,6 +1159,9 @@ McPhoto::dirtySamplePhotons(ParticleContainer<PointParticle>& a_photons,
 
   a_photons.clearParticles();
 
+  // Salt for the per-cell random number streams. Each packet uses different streams.
+  const uint64_t salt = Random::getStreamSalt(m_name + "::dirtySamplePhotons") + (uint64_t)a_packet;
+
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
     const DisjointBoxLayout& dbl    = m_amr->getGrids(m_realm)[lvl];
     const DataIterator&      dit    = dbl.dataIterator();
@@ -1172,6 +1192,8 @@ McPhoto::dirtySamplePhotons(ParticleContainer<PointParticle>& a_photons,
           const size_t num = numPhysPhotonsReg(iv, 0);
 
           if (num > 0) {
+            Random::setStream(m_timeStep, Random::getCellID(salt, lvl, iv));
+
             const std::vector<size_t> photonWeights = ParticleManagement::partitionParticleWeights(num,
                                                                                                    a_maxPhotonsPerCell);
 
@@ -1203,6 +1225,8 @@ McPhoto::dirtySamplePhotons(ParticleContainer<PointParticle>& a_photons,
           const size_t num = numPhysPhotons(vof, 0);
 
           if (num > 0) {
+            Random::setStream(m_timeStep, Random::getCellID(salt + vof.cellIndex(), lvl, iv));
+
             const std::vector<size_t> photonWeights = ParticleManagement::partitionParticleWeights(num,
                                                                                                    a_maxPhotonsPerCell);
 
@@ -1444,6 +1468,9 @@ McPhoto::advancePhotonsInstantaneous(ParticleContainer<Photon>& a_bulkPhotons,
   // This is the implicit function used for intersection tests
   const RefCountedPtr<BaseIF>& impFunc = m_computationalGeometry->getImplicitFunction(m_phase);
 
+  // Salt for the per-photon random number streams.
+  const uint64_t salt = Random::getStreamSalt(m_name + "::advancePhotonsInstantaneous");
+
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
     const DisjointBoxLayout& dbl = m_amr->getGrids(m_realm)[lvl];
     const DataIterator&      dit = dbl.dataIterator();
@@ -1460,10 +1487,17 @@ McPhoto::advancePhotonsInstantaneous(ParticleContainer<Photon>& a_bulkPhotons,
       List<Photon>& domPhotons  = a_domainPhotons[lvl][din].listItems();
       List<Photon>& allPhotons  = a_photons[lvl][din].listItems();
 
+      // Number of photons visited so far at each position. Used for giving coincident photons different streams.
+      std::unordered_map<uint64_t, uint64_t> numAtPosition;
+
       // Iterate over the Photons that will be moved.
       for (ListIterator<Photon> lit(allPhotons); lit.ok(); ++lit) {
         Photon& p = lit();
 
+        const uint64_t ordinal = numAtPosition[Random::getParticleID(salt, p.position(), 0)]++;
+
+        Random::setStream(m_timeStep, Random::getParticleID(salt, p.position(), ordinal));
+
         // Draw a new random absorption position
         const RealVect& oldPos    = p.position();
         const RealVect& direction = p.velocity() / (p.velocity().vectorLength());
@@ -1602,6 +1636,9 @@ McPhoto::advancePhotonsTransient(ParticleContainer<Photon>& a_bulkPhotons,
   // This is the implicit function used for intersection tests
   const RefCountedPtr<BaseIF>& impFunc = m_computationalGeometry->getImplicitFunction(m_phase);
 
+  // Salt for the per-photon random number streams.
+  const uint64_t salt = Random::getStreamSalt(m_name + "::advancePhotonsTransient");
+
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
     const DisjointBoxLayout& dbl = m_amr->getGrids(m_realm)[lvl];
     const DataIterator&      dit = dbl.dataIterator();
@@ -1618,10 +1655,17 @@ McPhoto::advancePhotonsTransient(ParticleContainer<Photon>& a_bulkPhotons,
       List<Photon>& domPhotons  = a_domainPhotons[lvl][din].listItems();
       List<Photon>& allPhotons  = a_photons[lvl][din].listItems();
 
+      // Number of photons visited so far at each position. Used for giving coincident photons different streams.
+      std::unordered_map<uint64_t, uint64_t> numAtPosition;
+
       // Iterate over the photons that will be moved.
       for (ListIterator<Photon> lit(allPhotons); lit.ok(); ++lit) {
         Photon& p = lit();
 
+        const uint64_t ordinal = numAtPosition[Random::getParticleID(salt, p.position(), 0)]++;
+
+        Random::setStream(m_timeStep, Random::getParticleID(salt, p.position(), ordinal));
+
         // Move the Photon
         const RealVect oldPos  = p.position();
         const RealVect v       = p.velocity();
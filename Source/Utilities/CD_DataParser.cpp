@@ -143,6 +143,69 @@ DataParser::fractionalFileReadASCII(const std::string       a_fileName,
   return returnTable;
 }
 
+LookupTable2D<Real, 1>
+DataParser::fractionalFileReadASCII2D(const std::string       a_fileName,
+                                      const std::string       a_startRead,
+                                      const std::string       a_stopRead,
+                                      const int               a_xColumn,
+                                      const int               a_yColumn,
+                                      const int               a_zColumn,
+                                      const std::vector<char> a_ignoreChars)
+{
+  CH_TIME("DataParser::fractionalFileReadASCII2D");
+
+  // This is the return table. It will be populated as we read the file.
+  LookupTable2D<Real, 1> returnTable;
+
+  // Open an input file stream and start reading lines.
+  bool          parseLine = false;
+  std::ifstream inputFile(a_fileName);
+  std::string   line;
+
+  while (std::getline(inputFile, line)) {
+
+    // Right trim line.
+    line.erase(line.find_last_not_of(" \n\r\t") + 1);
+
+    // Check if we should parse the line. We start and
+    // stop and we encounter the input strings.
+    if (line == a_startRead) {
+      parseLine = true;
+    }
+    else if (line == a_stopRead && parseLine) {
+      break;
+    }
+
+    if (parseLine && !line.empty()) {
+      // Check if we should parse the line. Lines starting with one of the comment symbols are not parsed.
+      bool lineIsCommented = false;
+      for (const auto& ignoreChar : a_ignoreChars) {
+        if (line.at(0) == ignoreChar) {
+          lineIsCommented = true;
+        }
+      }
+
+      if (!lineIsCommented) {
+        std::istringstream iss(line);
+
+        double              curVal;
+        std::vector<double> values;
+        while (iss >> curVal) {
+          values.emplace_back(curVal);
+        }
+
+        // Rows that do not have enough data WILL be ignored.
+        const int numColumnsOnThisLine = values.size();
+        if (a_xColumn < numColumnsOnThisLine && a_yColumn < numColumnsOnThisLine && a_zColumn < numColumnsOnThisLine) {
+          returnTable.addData(values[a_xColumn], values[a_yColumn], values[a_zColumn]);
+        }
+      }
+    }
+  }
+
+  return returnTable;
+}
+
 List<PointParticle>
 DataParser::readPointParticlesASCII(const std::string       a_fileName,
                                     const unsigned int      a_xColumn,
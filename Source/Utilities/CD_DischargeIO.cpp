@@ -11,6 +11,10 @@
 
 // Std includes
 #include <sstream>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <utility>
 
 // Chombo includes
 #include <CH_HDF5.H>
@@ -52,6 +56,125 @@ DischargeIO::numberFmt(const Vector<long long> a_numbers, char a_sep) noexcept
   return ret;
 }
 
+bool
+DischargeIO::PlotOptions::isDefault() const noexcept
+{
+  bool isDefault = (m_precision == Precision::Double) && (m_compression == Compression::None);
+
+  isDefault = isDefault && (m_absoluteError < 0.0) && (m_relativeError < 0.0);
+
+  for (const auto& p : m_variablePrecision) {
+    isDefault = isDefault && (p == Precision::Double);
+  }
+
+  return isDefault;
+}
+
+int
+DischargeIO::mantissaBits(const Precision a_precision) noexcept
+{
+  int bits = 52;
+
+  switch (a_precision) {
+  case Precision::Double: {
+    bits = 52;
+
+    break;
+  }
+  case Precision::Single: {
+    bits = 23;
+
+    break;
+  }
+  case Precision::Half: {
+    bits = 10;
+
+    break;
+  }
+  default: {
+    MayDay::Error("DischargeIO::mantissaBits -- logic bust");
+
+    break;
+  }
+  }
+
+  return bits;
+}
+
+Real
+DischargeIO::roundMantissa(const Real a_value, const int a_bits) noexcept
+{
+  constexpr int doubleBits = 52;
+
+  if (a_bits >= doubleBits || !std::isfinite(a_value)) {
+    return a_value;
+  }
+
+  // TLDR: Add half of the last retained bit to the magnitude bits and truncate the rest. This is round-to-nearest
+  //       (ties away from zero). A carry into the exponent is fine since the mantissa then rolls over to the next binade.
+  const int numDrop = doubleBits - std::max(0, a_bits);
+
+  double   value = static_cast<double>(a_value);
+  uint64_t bits;
+
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  const uint64_t half = uint64_t(1) << (numDrop - 1);
+  const uint64_t mask = ~((uint64_t(1) << numDrop) - 1);
+
+  bits = (bits + half) & mask;
+
+  std::memcpy(&value, &bits, sizeof(value));
+
+  return static_cast<Real>(value);
+}
+
+uint16_t
+DischargeIO::toHalf(const Real a_value) noexcept
+{
+  // TLDR: Convert via single precision. Large numbers (>= 65520) become infinity, NaN stays NaN, and small numbers are
+  //       rounded into the subnormal half-precision range by adding a magic number that aligns the mantissa. Everything else
+  //       is rounded to nearest even by adjusting the exponent bias and rounding away the 13 lowest mantissa bits.
+  const float f = static_cast<float>(a_value);
+
+  uint32_t u;
+  std::memcpy(&u, &f, sizeof(u));
+
+  const uint32_t sign = u & 0x80000000u;
+
+  u ^= sign;
+
+  uint16_t h;
+
+  if (u >= (143u << 23)) {
+    h = (u > (255u << 23)) ? 0x7e00 : 0x7c00;
+  }
+  else if (u < (113u << 23)) {
+    const uint32_t magicBits = 126u << 23;
+
+    float magic;
+    float g;
+
+    std::memcpy(&magic, &magicBits, sizeof(magic));
+    std::memcpy(&g, &u, sizeof(g));
+
+    g += magic;
+
+    std::memcpy(&u, &g, sizeof(u));
+
+    h = static_cast<uint16_t>(u - magicBits);
+  }
+  else {
+    const uint32_t isOdd = (u >> 13) & 1u;
+
+    u += (uint32_t(15 - 127) << 23) + 0xfffu + isOdd;
+
+    h = static_cast<uint16_t>(u >> 13);
+  }
+
+  return h | static_cast<uint16_t>(sign >> 16);
+}
+
 #ifdef CH_USE_HDF5
 void
 DischargeIO::writeEBHDF5Header(HDF5Handle&                a_handleH5,
@@ -64,6 +187,39 @@ DischargeIO::writeEBHDF5Header(HDF5Handle&                a_handleH5,
   CH_assert(a_handleH5.isOpen());
   CH_assert(a_numLevels >= 0);
 
+  // Variable names of all components. This is the user input variables plus the EB-related variables for doing the EB
+  // reconstruction.
+  const Vector<std::string> variableNamesHDF5 = DischargeIO::getEBHDF5ComponentNames(a_variableNames);
+
+  const int numCompTotal = variableNamesHDF5.size();
+
+  // Write the header to file.
+  HDF5HeaderData header;
+
+  header.m_string["filetype"]    = "VanillaAMRFileType";
+  header.m_int["num_levels"]     = a_numLevels;
+  header.m_int["num_components"] = numCompTotal;
+#if 0 // Uncommenting this because VisIt doesn't know what to do with it.
+  header.m_realvect["prob_lo"]   = a_probLo;
+#endif
+
+  for (int comp = 0; comp < numCompTotal; comp++) {
+    char labelString[100];
+    sprintf(labelString, "component_%d", comp);
+
+    std::string label(labelString);
+
+    header.m_string[label] = variableNamesHDF5[comp];
+  }
+
+  header.writeToFile(a_handleH5);
+}
+#endif
+
+#ifdef CH_USE_HDF5
+Vector<std::string>
+DischargeIO::getEBHDF5ComponentNames(const Vector<std::string>& a_variableNames) noexcept
+{
   const int numInputVars      = a_variableNames.size();
   const int indexVolFrac      = numInputVars;
   const int indexBoundaryArea = indexVolFrac + 1;
@@ -72,8 +228,6 @@ DischargeIO::writeEBHDF5Header(HDF5Handle&                a_handleH5,
   const int indexDist         = indexNormal + SpaceDim;
   const int numCompTotal      = indexDist + 1;
 
-  // Now create a vector of all the variable names. This is the user input variables plus the EB-related variables
-  // for doing the EB reconstruction.
   Vector<std::string> variableNamesHDF5(numCompTotal);
 
   const std::string volFracName("fraction-0");
@@ -112,50 +266,864 @@ DischargeIO::writeEBHDF5Header(HDF5Handle&                a_handleH5,
 
   variableNamesHDF5[indexDist] = distName;
 
-  // Write the header to file.
-  HDF5HeaderData header;
-
-  header.m_string["filetype"]    = "VanillaAMRFileType";
-  header.m_int["num_levels"]     = a_numLevels;
-  header.m_int["num_components"] = numCompTotal;
-#if 0 // Uncommenting this because VisIt doesn't know what to do with it.
-  header.m_realvect["prob_lo"]   = a_probLo;
+  return variableNamesHDF5;
+}
 #endif
 
-  for (int comp = 0; comp < numCompTotal; comp++) {
-    char labelString[100];
-    sprintf(labelString, "component_%d", comp);
-
-    std::string label(labelString);
-
-    header.m_string[label] = variableNamesHDF5[comp];
-  }
-
-  header.writeToFile(a_handleH5);
+#ifdef CH_USE_HDF5
+void
+DischargeIO::writeEBHDF5Level(HDF5Handle&                 a_handleH5,
+                              const LevelData<EBCellFAB>& a_outputData,
+                              const ProblemDomain         a_domain,
+                              const Real                  a_dx,
+                              const Real                  a_dt,
+                              const Real                  a_time,
+                              const int                   a_level,
+                              const int                   a_refRatio,
+                              const int                   a_numGhost,
+                              const PlotOptions&          a_options) noexcept
+{
+  CH_TIME("DischargeIO::writeEBHDF5Level(LevelData<EBCellFAB>)");
+
+  LevelData<FArrayBox> levelData;
+
+  DischargeIO::makeEBHDF5LevelData(levelData, a_outputData, a_domain, a_dx, a_numGhost);
+  DischargeIO::writeEBHDF5Level(a_handleH5,
+                                levelData,
+                                a_domain,
+                                a_dx,
+                                a_dt,
+                                a_time,
+                                a_level,
+                                a_refRatio,
+                                a_numGhost,
+                                a_options);
 }
 #endif
 
 #ifdef CH_USE_HDF5
 void
 DischargeIO::writeEBHDF5Level(HDF5Handle&                 a_handleH5,
-                              const LevelData<EBCellFAB>& a_outputData,
+                              const LevelData<FArrayBox>& a_levelData,
                               const ProblemDomain         a_domain,
                               const Real                  a_dx,
                               const Real                  a_dt,
                               const Real                  a_time,
                               const int                   a_level,
                               const int                   a_refRatio,
-                              const int                   a_numGhost) noexcept
+                              const int                   a_numGhost,
+                              const PlotOptions&          a_options) noexcept
+{
+  CH_TIME("DischargeIO::writeEBHDF5Level(LevelData<FArrayBox>)");
+
+  CH_assert(a_refRatio > 0);
+  CH_assert(a_numGhost >= 0);
+
+  // Components after the plot variables are the EB moments, see makeEBHDF5LevelData.
+  const int numEBComps  = 3 + 3 * SpaceDim;
+  const int numPlotVars = a_levelData.nComp() - numEBComps;
+
+  CH_assert(numPlotVars >= 0);
+
+  if (!(a_options.isDefault())) {
+    DischargeIO::writeReducedPrecisionLevel(a_handleH5,
+                                            a_levelData,
+                                            a_domain,
+                                            a_dx,
+                                            a_dt,
+                                            a_time,
+                                            a_level,
+                                            a_refRatio,
+                                            a_numGhost,
+                                            numPlotVars,
+                                            a_options);
+
+    return;
+  }
+
+  const int success = writeLevel(a_handleH5,
+                                 a_level,
+                                 a_levelData,
+                                 a_dx,
+                                 a_dt,
+                                 a_time,
+                                 a_domain.domainBox(),
+                                 a_refRatio,
+                                 a_numGhost * IntVect::Unit,
+                                 Interval(0, a_levelData.nComp() - 1));
+
+  if (success != 0) {
+    MayDay::Error("DischargeIO::writeEBHDF5Level -- error in writeLevel");
+  }
+}
+#endif
+
+#ifdef CH_USE_HDF5
+void
+DischargeIO::writeReducedPrecisionLevel(HDF5Handle&                 a_handleH5,
+                                        const LevelData<FArrayBox>& a_levelData,
+                                        const ProblemDomain         a_domain,
+                                        const Real                  a_dx,
+                                        const Real                  a_dt,
+                                        const Real                  a_time,
+                                        const int                   a_level,
+                                        const int                   a_refRatio,
+                                        const int                   a_numGhost,
+                                        const int                   a_numPlotVars,
+                                        const PlotOptions&          a_options) noexcept
+{
+  CH_TIMERS("DischargeIO::writeReducedPrecisionLevel");
+  CH_TIMER("DischargeIO::writeReducedPrecisionLevel::metadata", t1);
+  CH_TIMER("DischargeIO::writeReducedPrecisionLevel::pack_data", t2);
+  CH_TIMER("DischargeIO::writeReducedPrecisionLevel::write_data", t3);
+
+  CH_assert(a_refRatio > 0);
+  CH_assert(a_numGhost >= 0);
+  CH_assert(a_numPlotVars >= 0 && a_numPlotVars <= a_levelData.nComp());
+
+  // TLDR: This routine writes exactly the same groups, attributes, and datasets as Chombo's writeLevel so that the files
+  //       are readable by VisIt and by Chombo. The data in each box is written component-by-component in Fortran order
+  //       over the box grown by the output ghost cells, and the box offsets are stored in "data:offsets=0". The difference
+  //       from writeLevel is that the data is rounded to the requested precision before it is written, and that the data
+  //       is stored in a chunked dataset that can be compressed with filters that ship with HDF5.
+
+  const DisjointBoxLayout& dbl         = a_levelData.disjointBoxLayout();
+  const int                numComp     = a_levelData.nComp();
+  const IntVect            outputGhost = a_numGhost * IntVect::Unit;
+
+  PlotOptions options = a_options;
+
+#if defined(CH_MPI) && !H5_VERSION_GE(1, 10, 2)
+  // Parallel writes to filtered datasets require HDF5 1.10.2 or newer.
+  if (options.m_compression != Compression::None) {
+    static bool hasWarned = false;
+
+    if (!hasWarned) {
+      MayDay::Warning("DischargeIO::writeReducedPrecisionLevel -- parallel compression requires HDF5 >= 1.10.2");
+
+      hasWarned = true;
+    }
+
+    options.m_compression = Compression::None;
+  }
+#endif
+
+  // Write the level attributes, the boxes, and the data attributes.
+  CH_START(t1);
+  char levelName[20];
+  sprintf(levelName, "/level_%i", a_level);
+
+  const std::string currentGroup = a_handleH5.getGroup();
+  const std::string levelGroup   = currentGroup + std::string(levelName);
+
+  a_handleH5.setGroup(levelGroup);
+
+  HDF5HeaderData meta;
+  meta.m_real["dx"]         = a_dx;
+  meta.m_real["dt"]         = a_dt;
+  meta.m_real["time"]       = a_time;
+  meta.m_box["prob_domain"] = a_domain.domainBox();
+  meta.m_int["ref_ratio"]   = a_refRatio;
+  meta.writeToFile(a_handleH5);
+
+  if (write(a_handleH5, dbl, "boxes") != 0) {
+    MayDay::Error("DischargeIO::writeReducedPrecisionLevel -- could not write boxes");
+  }
+
+  HDF5HeaderData info;
+  info.m_intvect["ghost"]       = a_levelData.ghostVect();
+  info.m_intvect["outputGhost"] = outputGhost;
+  info.m_int["comps"]           = numComp;
+  info.m_string["objectType"]   = "FArrayBox";
+
+  a_handleH5.setGroup(levelGroup + "/data_attributes");
+  info.writeToFile(a_handleH5);
+  a_handleH5.setGroup(levelGroup);
+
+  // Compute the global offsets for each box.
+  std::vector<long long> offsets(1, 0LL);
+  for (LayoutIterator lit = dbl.layoutIterator(); lit.ok(); ++lit) {
+    const Box writeBox = grow(dbl[lit()], outputGhost);
+
+    offsets.emplace_back(offsets.back() + writeBox.numPts() * numComp);
+  }
+  CH_STOP(t1);
+
+  // Pack the data on this rank, sorted by the global box index so that the memory layout matches the order of the file
+  // selection in writeLevelDataset.
+  CH_START(t2);
+  std::vector<std::pair<int, DataIndex>> localBoxes;
+  for (DataIterator dit = dbl.dataIterator(); dit.ok(); ++dit) {
+    localBoxes.emplace_back(dbl.index(dit()), dit());
+  }
+
+  std::sort(localBoxes.begin(),
+            localBoxes.end(),
+            [](const std::pair<int, DataIndex>& a, const std::pair<int, DataIndex>& b) -> bool {
+              return a.first < b.first;
+            });
+
+  std::vector<int>  boxIndices;
+  std::vector<Real> buffer;
+  for (const auto& localBox : localBoxes) {
+    const FArrayBox& fab      = a_levelData[localBox.second];
+    const Box        writeBox = grow(dbl[localBox.second], outputGhost);
+
+    CH_assert(fab.box().contains(writeBox));
+
+    boxIndices.emplace_back(localBox.first);
+
+    for (int comp = 0; comp < numComp; comp++) {
+      for (BoxIterator bit(writeBox); bit.ok(); ++bit) {
+        buffer.emplace_back(fab(bit(), comp));
+      }
+    }
+  }
+  CH_STOP(t2);
+
+  // Create the datasets and write the data.
+  CH_START(t3);
+#ifdef CH_MPI
+  const bool collective = true;
+#else
+  const bool collective = false;
+#endif
+
+  DischargeIO::writeLevelDataset(a_handleH5.groupID(),
+                                 buffer,
+                                 offsets,
+                                 boxIndices,
+                                 numComp,
+                                 a_numPlotVars,
+                                 options,
+                                 procID() == 0,
+                                 collective);
+
+  a_handleH5.setGroup(currentGroup);
+  CH_STOP(t3);
+}
+#endif
+
+#ifdef CH_USE_HDF5
+void
+DischargeIO::writeLevelDataset(const hid_t                   a_groupID,
+                               const std::vector<Real>&      a_buffer,
+                               const std::vector<long long>& a_offsets,
+                               const std::vector<int>&       a_boxIndices,
+                               const int                     a_numComp,
+                               const int                     a_numPlotVars,
+                               const PlotOptions&            a_options,
+                               const bool                    a_writeOffsets,
+                               const bool                    a_collective) noexcept
+{
+  // TLDR: There is no CH_TIME in here because this is also called by the asynchronous plot file writer, which runs on a
+  //       separate thread (see writeSerialEBHDF5).
+  CH_assert(a_numComp > 0);
+  CH_assert(a_offsets.size() > 0);
+
+  // Number of mantissa bits that we keep for each component. The plot variables can have reduced precision and are subject
+  // to error bounds. The EB moments are stored with the storage precision.
+  const Precision storagePrecision = a_options.m_precision;
+  const int       storageBits      = DischargeIO::mantissaBits(storagePrecision);
+
+  std::vector<int> compBits(a_numComp, storageBits);
+
+  for (int comp = 0; comp < a_numPlotVars; comp++) {
+    if (comp < int(a_options.m_variablePrecision.size())) {
+      compBits[comp] = std::min(storageBits, DischargeIO::mantissaBits(a_options.m_variablePrecision[comp]));
+    }
+
+    if (a_options.m_relativeError > 0.0) {
+      const int relBits = std::max(0, int(std::ceil(-std::log2(a_options.m_relativeError) - 1.0)));
+
+      compBits[comp] = std::min(compBits[comp], relBits);
+    }
+  }
+
+  const Real quantum = 2.0 * a_options.m_absoluteError;
+
+  // Write the box offsets.
+  hsize_t numOffsets = a_offsets.size();
+
+  hid_t offsetSpace = H5Screate_simple(1, &numOffsets, nullptr);
+  hid_t offsetSet   = H5Dcreate2(a_groupID,
+                               "data:offsets=0",
+                               H5T_NATIVE_LLONG,
+                               offsetSpace,
+                               H5P_DEFAULT,
+                               H5P_DEFAULT,
+                               H5P_DEFAULT);
+
+  if (a_writeOffsets) {
+    H5Dwrite(offsetSet, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, a_offsets.data());
+  }
+
+  H5Dclose(offsetSet);
+  H5Sclose(offsetSpace);
+
+  // Round the data and convert it to the storage type. The memory type is identical to the file type so HDF5 does not
+  // need to convert anything.
+  hid_t fileType = H5T_NATIVE_DOUBLE;
+
+  std::vector<double>   bufferDouble;
+  std::vector<float>    bufferSingle;
+  std::vector<uint16_t> bufferHalf;
+
+  switch (storagePrecision) {
+  case Precision::Double: {
+    fileType = H5T_NATIVE_DOUBLE;
+
+    bufferDouble.reserve(a_buffer.size() + 1);
+
+    break;
+  }
+  case Precision::Single: {
+    fileType = H5T_NATIVE_FLOAT;
+
+    bufferSingle.reserve(a_buffer.size() + 1);
+
+    break;
+  }
+  case Precision::Half: {
+    fileType = H5Tcopy(H5T_NATIVE_FLOAT);
+
+    H5Tset_fields(fileType, 15, 10, 5, 0, 10);
+    H5Tset_size(fileType, 2);
+    H5Tset_ebias(fileType, 15);
+
+    bufferHalf.reserve(a_buffer.size() + 1);
+
+    break;
+  }
+  default: {
+    MayDay::Error("DischargeIO::writeLevelDataset -- logic bust");
+
+    break;
+  }
+  }
+
+  size_t k = 0;
+  for (const auto& boxIndex : a_boxIndices) {
+    const long long numPts = (a_offsets[boxIndex + 1] - a_offsets[boxIndex]) / a_numComp;
+
+    for (int comp = 0; comp < a_numComp; comp++) {
+      const bool isPlotVar = comp < a_numPlotVars;
+      const int  bits      = compBits[comp];
+
+      for (long long i = 0; i < numPts; i++, k++) {
+        Real value = a_buffer[k];
+
+        if (isPlotVar && quantum > 0.0 && std::isfinite(value)) {
+          value = quantum * std::round(value / quantum);
+        }
+
+        value = DischargeIO::roundMantissa(value, bits);
+
+        switch (storagePrecision) {
+        case Precision::Double: {
+          bufferDouble.emplace_back(value);
+
+          break;
+        }
+        case Precision::Single: {
+          bufferSingle.emplace_back(value);
+
+          break;
+        }
+        case Precision::Half: {
+          bufferHalf.emplace_back(DischargeIO::toHalf(value));
+
+          break;
+        }
+        }
+      }
+    }
+  }
+
+  CH_assert(k == a_buffer.size());
+
+  // Pad the buffers so that we never pass a null pointer to HDF5.
+  bufferDouble.emplace_back(0.0);
+  bufferSingle.emplace_back(0.0F);
+  bufferHalf.emplace_back(0);
+
+  const void* writePtr = nullptr;
+
+  switch (storagePrecision) {
+  case Precision::Double: {
+    writePtr = bufferDouble.data();
+
+    break;
+  }
+  case Precision::Single: {
+    writePtr = bufferSingle.data();
+
+    break;
+  }
+  case Precision::Half: {
+    writePtr = bufferHalf.data();
+
+    break;
+  }
+  }
+
+  // Create the dataset and write the data.
+  hsize_t totalSize = a_offsets.back();
+  hsize_t localSize = a_buffer.size();
+
+  hid_t fileSpace   = H5Screate_simple(1, &totalSize, nullptr);
+  hid_t createProps = H5Pcreate(H5P_DATASET_CREATE);
+
+  if (a_options.m_compression != Compression::None && totalSize > 0) {
+    const hsize_t chunkSize = std::min(totalSize, hsize_t(std::max(1, a_options.m_chunkSize)));
+
+    H5Pset_chunk(createProps, 1, &chunkSize);
+
+    if (a_options.m_compression == Compression::ShuffleDeflate) {
+      H5Pset_shuffle(createProps);
+    }
+
+    H5Pset_deflate(createProps, std::min(9, std::max(0, a_options.m_compressionLevel)));
+  }
+
+  hid_t dataSet = H5Dcreate2(a_groupID, "data:datatype=0", fileType, fileSpace, H5P_DEFAULT, createProps, H5P_DEFAULT);
+
+  if (dataSet < 0) {
+    MayDay::Error("DischargeIO::writeLevelDataset -- could not create dataset");
+  }
+
+  H5Sselect_none(fileSpace);
+  for (const auto& boxIndex : a_boxIndices) {
+    const hsize_t start = a_offsets[boxIndex];
+    const hsize_t count = a_offsets[boxIndex + 1] - a_offsets[boxIndex];
+
+    if (count > 0) {
+      H5Sselect_hyperslab(fileSpace, H5S_SELECT_OR, &start, nullptr, &count, nullptr);
+    }
+  }
+
+  hid_t memSpace = H5Screate_simple(1, &localSize, nullptr);
+  if (localSize == 0) {
+    H5Sselect_none(memSpace);
+  }
+
+  hid_t transferProps = H5Pcreate(H5P_DATASET_XFER);
+#ifdef CH_MPI
+  if (a_collective) {
+    H5Pset_dxpl_mpio(transferProps, H5FD_MPIO_COLLECTIVE);
+  }
+#endif
+
+  const herr_t err = H5Dwrite(dataSet, fileType, memSpace, fileSpace, transferProps, writePtr);
+
+  if (err < 0) {
+    MayDay::Error("DischargeIO::writeLevelDataset -- could not write data");
+  }
+
+  H5Pclose(transferProps);
+  H5Sclose(memSpace);
+  H5Dclose(dataSet);
+  H5Pclose(createProps);
+  H5Sclose(fileSpace);
+
+  if (storagePrecision == Precision::Half) {
+    H5Tclose(fileType);
+  }
+}
+#endif
+
+#ifdef CH_USE_HDF5
+void
+DischargeIO::gatherEBHDF5LevelData(SerialLevelData&            a_serialData,
+                                   const LevelData<FArrayBox>& a_levelData,
+                                   const ProblemDomain         a_domain,
+                                   const Real                  a_dx,
+                                   const int                   a_refRatio,
+                                   const int                   a_numGhost,
+                                   const int                   a_rank) noexcept
 {
-  CH_TIMERS("DischargeIO::writeEBHDF5Level");
-  CH_TIMER("DischargeIO::writeEBHDF5Level::alloc", t1);
-  CH_TIMER("DischargeIO::writeEBHDF5Level::copy_vars", t2);
-  CH_TIMER("DischargeIO::writeEBHDF5Level::average_multicells", t3);
-  CH_TIMER("DischargeIO::writeEBHDF5Level::set_default_data", t4);
-  CH_TIMER("DischargeIO::writeEBHDF5Level::set_eb_moments", t5);
-  CH_TIMER("DischargeIO::writeEBHDF5Level::set_ghosts", t6);
+  CH_TIMERS("DischargeIO::gatherEBHDF5LevelData");
+  CH_TIMER("DischargeIO::gatherEBHDF5LevelData::pack_data", t1);
+  CH_TIMER("DischargeIO::gatherEBHDF5LevelData::communicate", t2);
 
   CH_assert(a_refRatio > 0);
+  CH_assert(a_numGhost >= 0);
+  CH_assert(a_rank >= 0 && a_rank < numProc());
+
+  // TLDR: Every rank packs its boxes in the same format as the HDF5 dataset (see writeLevelDataset), and a_rank receives the
+  //       data from the other ranks directly into the position of each box in the global buffer. We use one message per box
+  //       rather than MPI_Gatherv because the int-valued displacements in MPI_Gatherv overflow for large levels. All messages
+  //       use the same tag (box indices can exceed MPI_TAG_UB), which is fine because messages between two ranks are not
+  //       overtaking. Each rank sends its boxes in increasing index order, and a_rank posts the receives in the same order.
+  const DisjointBoxLayout& dbl         = a_levelData.disjointBoxLayout();
+  const int                numComp     = a_levelData.nComp();
+  const IntVect            outputGhost = a_numGhost * IntVect::Unit;
+  const bool               isRoot      = (procID() == a_rank);
+
+  a_serialData.domain   = a_domain;
+  a_serialData.dx       = a_dx;
+  a_serialData.refRatio = a_refRatio;
+  a_serialData.numComp  = numComp;
+
+  a_serialData.boxes.resize(0);
+  a_serialData.offsets.assign(1, 0LL);
+  a_serialData.data.resize(0);
+
+  std::vector<int> ranks;
+
+  for (LayoutIterator lit = dbl.layoutIterator(); lit.ok(); ++lit) {
+    const Box writeBox = grow(dbl[lit()], outputGhost);
+
+    a_serialData.boxes.emplace_back(dbl[lit()]);
+    a_serialData.offsets.emplace_back(a_serialData.offsets.back() + writeBox.numPts() * numComp);
+
+    ranks.emplace_back(dbl.procID(lit()));
+  }
+
+  std::vector<std::pair<int, DataIndex>> localBoxes;
+  for (DataIterator dit = dbl.dataIterator(); dit.ok(); ++dit) {
+    localBoxes.emplace_back(dbl.index(dit()), dit());
+  }
+
+  std::sort(localBoxes.begin(),
+            localBoxes.end(),
+            [](const std::pair<int, DataIndex>& a, const std::pair<int, DataIndex>& b) -> bool {
+              return a.first < b.first;
+            });
+
+  if (isRoot) {
+    a_serialData.data.resize(a_serialData.offsets.back());
+  }
+
+  std::vector<Real> sendBuffer;
+  for (const auto& localBox : localBoxes) {
+    CH_START(t1);
+    const int        boxIndex = localBox.first;
+    const FArrayBox& fab      = a_levelData[localBox.second];
+    const Box        writeBox = grow(dbl[localBox.second], outputGhost);
+
+    CH_assert(fab.box().contains(writeBox));
+
+    Real* dst = nullptr;
+
+    if (isRoot) {
+      dst = &(a_serialData.data[a_serialData.offsets[boxIndex]]);
+    }
+    else {
+      sendBuffer.resize(a_serialData.offsets[boxIndex + 1] - a_serialData.offsets[boxIndex]);
+
+      dst = sendBuffer.data();
+    }
+
+    for (int comp = 0; comp < numComp; comp++) {
+      for (BoxIterator bit(writeBox); bit.ok(); ++bit, ++dst) {
+        *dst = fab(bit(), comp);
+      }
+    }
+    CH_STOP(t1);
+
+#ifdef CH_MPI
+    // Blocking sends are fine here because a_rank posts all its receives before it waits for any of them.
+    if (!isRoot) {
+      CH_START(t2);
+      MPI_Send(sendBuffer.data(), int(sendBuffer.size()), MPI_CH_REAL, a_rank, 0, Chombo_MPI::comm);
+      CH_STOP(t2);
+    }
+#endif
+  }
+
+#ifdef CH_MPI
+  CH_START(t2);
+  if (isRoot) {
+    const int numBoxes = a_serialData.boxes.size();
+
+    std::vector<MPI_Request> requests;
+
+    for (int ibox = 0; ibox < numBoxes; ibox++) {
+      if (ranks[ibox] != a_rank) {
+        const int count = int(a_serialData.offsets[ibox + 1] - a_serialData.offsets[ibox]);
+
+        requests.emplace_back();
+
+        MPI_Irecv(&(a_serialData.data[a_serialData.offsets[ibox]]),
+                  count,
+                  MPI_CH_REAL,
+                  ranks[ibox],
+                  0,
+                  Chombo_MPI::comm,
+                  &requests.back());
+      }
+    }
+
+    if (requests.size() > 0) {
+      MPI_Waitall(int(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+    }
+  }
+  CH_STOP(t2);
+#endif
+}
+#endif
+
+#ifdef CH_USE_HDF5
+void
+DischargeIO::writeSerialEBHDF5(const std::string&                  a_filename,
+                               const Vector<std::string>&          a_variableNames,
+                               const std::vector<SerialLevelData>& a_levels,
+                               const Real                          a_dt,
+                               const Real                          a_time,
+                               const int                           a_numGhost,
+                               const PlotOptions&                  a_options) noexcept
+{
+  // TLDR: This writes the same groups, attributes, and datasets as writeEBHDF5Header and writeEBHDF5Level, but only
+  //       through the serial HDF5 API. In particular, the file is not opened through Chombo's HDF5Handle (which uses
+  //       MPI-IO on the global communicator when Chombo is compiled with MPI), and there are no Chombo timers in here.
+  //       This lets the asynchronous plot file writer in Driver call this from a separate thread.
+  CH_assert(a_numGhost >= 0);
+
+  const hid_t fileID = H5Fcreate(a_filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+
+  if (fileID < 0) {
+    MayDay::Error("DischargeIO::writeSerialEBHDF5 -- could not create file");
+  }
+
+  // Global attributes that Chombo's HDF5Handle writes when it creates a file.
+  const hid_t globalGroup = H5Gcreate2(fileID, "/Chombo_global", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+  DischargeIO::writeH5Attribute(globalGroup, "SpaceDim", int(SpaceDim));
+  DischargeIO::writeH5Attribute(globalGroup, "testReal", Real(0.0));
+
+  H5Gclose(globalGroup);
+
+  // File header, see writeEBHDF5Header.
+  const Vector<std::string> componentNames = DischargeIO::getEBHDF5ComponentNames(a_variableNames);
+
+  const int numComp     = componentNames.size();
+  const int numPlotVars = a_variableNames.size();
+  const int numLevels   = a_levels.size();
+
+  const hid_t rootGroup = H5Gopen2(fileID, "/", H5P_DEFAULT);
+
+  DischargeIO::writeH5Attribute(rootGroup, "filetype", std::string("VanillaAMRFileType"));
+  DischargeIO::writeH5Attribute(rootGroup, "num_levels", numLevels);
+  DischargeIO::writeH5Attribute(rootGroup, "num_components", numComp);
+
+  for (int comp = 0; comp < numComp; comp++) {
+    DischargeIO::writeH5Attribute(rootGroup, "component_" + std::to_string(comp), componentNames[comp]);
+  }
+
+  H5Gclose(rootGroup);
+
+  // Write the levels, see writeReducedPrecisionLevel.
+  const hid_t boxType = DischargeIO::createH5BoxType();
+
+  for (int lvl = 0; lvl < numLevels; lvl++) {
+    const SerialLevelData& levelData = a_levels[lvl];
+
+    CH_assert(levelData.numComp == numComp);
+    CH_assert(levelData.offsets.size() == levelData.boxes.size() + 1);
+    CH_assert(levelData.data.size() == size_t(levelData.offsets.back()));
+
+    const std::string levelName  = "/level_" + std::to_string(lvl);
+    const hid_t       levelGroup = H5Gcreate2(fileID, levelName.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+    DischargeIO::writeH5Attribute(levelGroup, "dx", levelData.dx);
+    DischargeIO::writeH5Attribute(levelGroup, "dt", a_dt);
+    DischargeIO::writeH5Attribute(levelGroup, "time", a_time);
+    DischargeIO::writeH5Attribute(levelGroup, "prob_domain", levelData.domain.domainBox());
+    DischargeIO::writeH5Attribute(levelGroup, "ref_ratio", levelData.refRatio);
+
+    // Boxes.
+    const int numBoxes = levelData.boxes.size();
+
+    std::vector<int> boxData;
+    for (const auto& box : levelData.boxes) {
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        boxData.emplace_back(box.smallEnd(dir));
+      }
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        boxData.emplace_back(box.bigEnd(dir));
+      }
+    }
+
+    hsize_t     numBoxesH5 = numBoxes;
+    const hid_t boxSpace   = H5Screate_simple(1, &numBoxesH5, nullptr);
+    const hid_t boxSet = H5Dcreate2(levelGroup, "boxes", boxType, boxSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+    if (numBoxes > 0) {
+      H5Dwrite(boxSet, boxType, H5S_ALL, H5S_ALL, H5P_DEFAULT, boxData.data());
+    }
+
+    H5Dclose(boxSet);
+    H5Sclose(boxSpace);
+
+    // Data attributes.
+    const hid_t attrGroup = H5Gcreate2(levelGroup, "data_attributes", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+    DischargeIO::writeH5Attribute(attrGroup, "ghost", a_numGhost * IntVect::Unit);
+    DischargeIO::writeH5Attribute(attrGroup, "outputGhost", a_numGhost * IntVect::Unit);
+    DischargeIO::writeH5Attribute(attrGroup, "comps", numComp);
+    DischargeIO::writeH5Attribute(attrGroup, "objectType", std::string("FArrayBox"));
+
+    H5Gclose(attrGroup);
+
+    // Data.
+    std::vector<int> boxIndices(numBoxes);
+    for (int ibox = 0; ibox < numBoxes; ibox++) {
+      boxIndices[ibox] = ibox;
+    }
+
+    DischargeIO::writeLevelDataset(levelGroup,
+                                   levelData.data,
+                                   levelData.offsets,
+                                   boxIndices,
+                                   numComp,
+                                   numPlotVars,
+                                   a_options,
+                                   true,
+                                   false);
+
+    H5Gclose(levelGroup);
+  }
+
+  H5Tclose(boxType);
+  H5Fclose(fileID);
+}
+#endif
+
+#ifdef CH_USE_HDF5
+hid_t
+DischargeIO::createH5BoxType() noexcept
+{
+  // Same layout as Chombo's Box::H5Type, i.e. the lower corner followed by the upper corner.
+  const char* loNames[3] = {"lo_i", "lo_j", "lo_k"};
+  const char* hiNames[3] = {"hi_i", "hi_j", "hi_k"};
+
+  const hid_t boxType = H5Tcreate(H5T_COMPOUND, 2 * SpaceDim * sizeof(int));
+
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    H5Tinsert(boxType, loNames[dir], dir * sizeof(int), H5T_NATIVE_INT);
+  }
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    H5Tinsert(boxType, hiNames[dir], (SpaceDim + dir) * sizeof(int), H5T_NATIVE_INT);
+  }
+
+  return boxType;
+}
+
+hid_t
+DischargeIO::createH5IntVectType() noexcept
+{
+  // Same layout as Chombo's IntVect::H5Type.
+  const char* names[3] = {"intvecti", "intvectj", "intvectk"};
+
+  const hid_t intVectType = H5Tcreate(H5T_COMPOUND, SpaceDim * sizeof(int));
+
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    H5Tinsert(intVectType, names[dir], dir * sizeof(int), H5T_NATIVE_INT);
+  }
+
+  return intVectType;
+}
+
+void
+DischargeIO::writeH5Attribute(const hid_t a_location, const std::string& a_name, const int a_value) noexcept
+{
+  const hid_t space = H5Screate(H5S_SCALAR);
+  const hid_t attr  = H5Acreate2(a_location, a_name.c_str(), H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT);
+
+  H5Awrite(attr, H5T_NATIVE_INT, &a_value);
+
+  H5Aclose(attr);
+  H5Sclose(space);
+}
+
+void
+DischargeIO::writeH5Attribute(const hid_t a_location, const std::string& a_name, const Real a_value) noexcept
+{
+  const hid_t space = H5Screate(H5S_SCALAR);
+  const hid_t attr  = H5Acreate2(a_location, a_name.c_str(), H5T_NATIVE_REAL, space, H5P_DEFAULT, H5P_DEFAULT);
+
+  H5Awrite(attr, H5T_NATIVE_REAL, &a_value);
+
+  H5Aclose(attr);
+  H5Sclose(space);
+}
+
+void
+DischargeIO::writeH5Attribute(const hid_t a_location, const std::string& a_name, const std::string& a_value) noexcept
+{
+  const hid_t stringType = H5Tcopy(H5T_C_S1);
+
+  H5Tset_size(stringType, std::max(size_t(1), a_value.size()));
+
+  const hid_t space = H5Screate(H5S_SCALAR);
+  const hid_t attr  = H5Acreate2(a_location, a_name.c_str(), stringType, space, H5P_DEFAULT, H5P_DEFAULT);
+
+  H5Awrite(attr, stringType, a_value.c_str());
+
+  H5Aclose(attr);
+  H5Sclose(space);
+  H5Tclose(stringType);
+}
+
+void
+DischargeIO::writeH5Attribute(const hid_t a_location, const std::string& a_name, const Box& a_value) noexcept
+{
+  int data[2 * SpaceDim];
+
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    data[dir]            = a_value.smallEnd(dir);
+    data[SpaceDim + dir] = a_value.bigEnd(dir);
+  }
+
+  const hid_t boxType = DischargeIO::createH5BoxType();
+  const hid_t space   = H5Screate(H5S_SCALAR);
+  const hid_t attr    = H5Acreate2(a_location, a_name.c_str(), boxType, space, H5P_DEFAULT, H5P_DEFAULT);
+
+  H5Awrite(attr, boxType, data);
+
+  H5Aclose(attr);
+  H5Sclose(space);
+  H5Tclose(boxType);
+}
+
+void
+DischargeIO::writeH5Attribute(const hid_t a_location, const std::string& a_name, const IntVect& a_value) noexcept
+{
+  int data[SpaceDim];
+
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    data[dir] = a_value[dir];
+  }
+
+  const hid_t intVectType = DischargeIO::createH5IntVectType();
+  const hid_t space       = H5Screate(H5S_SCALAR);
+  const hid_t attr        = H5Acreate2(a_location, a_name.c_str(), intVectType, space, H5P_DEFAULT, H5P_DEFAULT);
+
+  H5Awrite(attr, intVectType, data);
+
+  H5Aclose(attr);
+  H5Sclose(space);
+  H5Tclose(intVectType);
+}
+#endif
+
+#ifdef CH_USE_HDF5
+void
+DischargeIO::makeEBHDF5LevelData(LevelData<FArrayBox>&       a_levelData,
+                                 const LevelData<EBCellFAB>& a_outputData,
+                                 const ProblemDomain         a_domain,
+                                 const Real                  a_dx,
+                                 const int                   a_numGhost) noexcept
+{
+  CH_TIMERS("DischargeIO::makeEBHDF5LevelData");
+  CH_TIMER("DischargeIO::makeEBHDF5LevelData::alloc", t1);
+  CH_TIMER("DischargeIO::makeEBHDF5LevelData::copy_vars", t2);
+  CH_TIMER("DischargeIO::makeEBHDF5LevelData::average_multicells", t3);
+  CH_TIMER("DischargeIO::makeEBHDF5LevelData::set_default_data", t4);
+  CH_TIMER("DischargeIO::makeEBHDF5LevelData::set_eb_moments", t5);
+  CH_TIMER("DischargeIO::makeEBHDF5LevelData::set_ghosts", t6);
+
   CH_assert(a_numGhost >= 0);
 
   const int numInputVars      = a_outputData.nComp();
@@ -169,7 +1137,7 @@ DischargeIO::writeEBHDF5Level(HDF5Handle&                 a_handleH5,
   const DisjointBoxLayout& dbl = a_outputData.disjointBoxLayout();
 
   CH_START(t1);
-  LevelData<FArrayBox> levelData(dbl, numCompTotal, a_numGhost * IntVect::Unit);
+  a_levelData.define(dbl, numCompTotal, a_numGhost * IntVect::Unit);
   CH_STOP(t1);
 
   const DataIterator& dit = dbl.dataIterator();
@@ -180,7 +1148,7 @@ DischargeIO::writeEBHDF5Level(HDF5Handle&                 a_handleH5,
   for (int mybox = 0; mybox < nbox; mybox++) {
     const DataIndex& din = dit[mybox];
 
-    FArrayBox&       levelFAB      = levelData[din];
+    FArrayBox&       levelFAB      = a_levelData[din];
     const EBCellFAB& outputData    = a_outputData[din];
     const FArrayBox& outputDataReg = outputData.getFArrayBox();
     const EBISBox&   ebisbox       = outputData.getEBISBox();
@@ -333,21 +1301,6 @@ DischargeIO::writeEBHDF5Level(HDF5Handle&                 a_handleH5,
     }
     CH_STOP(t6);
   }
-
-  const int success = writeLevel(a_handleH5,
-                                 a_level,
-                                 levelData,
-                                 a_dx,
-                                 a_dt,
-                                 a_time,
-                                 a_domain.domainBox(),
-                                 a_refRatio,
-                                 a_numGhost * IntVect::Unit,
-                                 Interval(0, numCompTotal - 1));
-
-  if (success != 0) {
-    MayDay::Error("DischargeIO::writeEBHDF5 -- error in writeLevel");
-  }
 }
 #endif
 
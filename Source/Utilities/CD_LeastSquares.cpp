@@ -9,12 +9,27 @@
   @author Robert Marskar
 */
 
+// Std includes
+#include <cmath>
+
+// Chombo includes
+#include <ParmParse.H>
+
 // Our includes
 #include <CD_LaPackUtils.H>
 #include <CD_LeastSquares.H>
 #include <CD_MultiIndex.H>
 #include <CD_NamespaceHeader.H>
 
+std::unordered_map<std::vector<long long>, std::vector<Real>, LeastSquares::CacheKeyHash> LeastSquares::s_cache;
+
+bool      LeastSquares::s_useCache       = false;
+Real      LeastSquares::s_cacheTolerance = 1.E-10;
+long long LeastSquares::s_maxCacheBytes  = 64LL * 1024LL * 1024LL;
+long long LeastSquares::s_cacheBytes     = 0LL;
+long long LeastSquares::s_cacheHits      = 0LL;
+long long LeastSquares::s_cacheLookups   = 0LL;
+
 VoFStencil
 LeastSquares::getInterpolationStencil(const CellLocation a_cellPos,
                                       const CellLocation a_otherCellsPos,
@@ -539,6 +554,31 @@ LeastSquares::computeSingleLevelStencils(const IntVectSet&       a_derivs,
     // This will also correspond to a modification of the right-hand side, but the required modifications are not accesible
     // in this routine, and so the user will have to make sense of them.
 
+    // Look for the solution in the stencil cache first. Many cut-cells have the same local geometry and therefore the same least squares system.
+    const std::vector<long long> key = LeastSquares::makeCacheKey(0,
+                                                                  a_derivs,
+                                                                  a_knownTerms,
+                                                                  a_displacements,
+                                                                  Vector<RealVect>(),
+                                                                  a_weights,
+                                                                  Vector<Real>(),
+                                                                  a_order);
+
+    std::vector<Real> cachedWeights;
+
+    if (LeastSquares::getCachedWeights(cachedWeights, key)) {
+      int d = 0;
+      for (IVSIterator ivsIt(a_derivs); ivsIt.ok(); ++ivsIt, d++) {
+        VoFStencil& sten = ret.at(ivsIt());
+
+        for (int k = 0; k < K; k++) {
+          sten.add(a_allVofs[k], cachedWeights[d * K + k]);
+        }
+      }
+
+      return ret;
+    }
+
     int          i = 0;                // Exists just because we fill memory linearly.
     Vector<Real> linA(K * M, 0.0);     // Equal to (w*A)
     Vector<Real> linAplus(M * K, 0.0); // Equal to (w*A)^+
@@ -601,8 +641,12 @@ LeastSquares::computeSingleLevelStencils(const IntVectSet&       a_derivs,
         for (int k = 0; k < K; k++) {
           const int idx = row + k * M;
           sten.add(a_allVofs[k], a_weights[k] * linAplus[idx]);
+
+          cachedWeights.emplace_back(a_weights[k] * linAplus[idx]);
         }
       }
+
+      LeastSquares::cacheWeights(key, cachedWeights);
     }
     else {
       MayDay::Warning("LeastSquares::computeSingleLevelStencils - could not perform singular value decomposition");
@@ -612,4 +656,206 @@ LeastSquares::computeSingleLevelStencils(const IntVectSet&       a_derivs,
   return ret;
 }
 
+size_t
+LeastSquares::CacheKeyHash::operator()(const std::vector<long long>& a_key) const noexcept
+{
+  size_t seed = a_key.size();
+
+  for (const auto& k : a_key) {
+    seed ^= std::hash<long long>()(k) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  }
+
+  return seed;
+}
+
+void
+LeastSquares::parseCacheOptions() noexcept
+{
+  // Function-local statics are initialized exactly once, also when called from multiple threads.
+  static const bool parsed = []() -> bool {
+    ParmParse pp("LeastSquares");
+
+    pp.query("cache", s_useCache);
+    pp.query("cache_tolerance", s_cacheTolerance);
+
+    Real maxMemory = s_maxCacheBytes / (1024.0 * 1024.0);
+
+    pp.query("cache_max_memory", maxMemory);
+
+    s_maxCacheBytes = std::llround(std::max(0.0, maxMemory) * 1024.0 * 1024.0);
+
+    return true;
+  }();
+
+  (void)parsed;
+}
+
+std::vector<long long>
+LeastSquares::makeCacheKey(const int               a_tag,
+                           const IntVectSet&       a_derivs,
+                           const IntVectSet&       a_knownTerms,
+                           const Vector<RealVect>& a_fineDisplacements,
+                           const Vector<RealVect>& a_coarDisplacements,
+                           const Vector<Real>&     a_fineWeights,
+                           const Vector<Real>&     a_coarWeights,
+                           const int               a_order) noexcept
+{
+  // TLDR: The key consists of the specification of the system (tag, order, number of equations, derivatives and known terms), followed by the
+  //       displacements and weights which are quantized to the specified relative tolerance. The displacements are quantized in units of the
+  //       length of the largest displacement vector, and this length scale is also included in the key (in logarithmic form, to the same relative tolerance).
+  //       The weights are quantized relative to the largest weight since the solution is invariant under a uniform scaling of the weights. Two
+  //       systems that map to the same key are identical up to the specified tolerance.
+
+  LeastSquares::parseCacheOptions();
+
+  std::vector<long long> key;
+
+  if (!s_useCache || s_cacheTolerance <= 0.0) {
+    return key;
+  }
+
+  Real maxDisp   = 0.0;
+  Real maxWeight = 0.0;
+
+  for (const auto& d : a_fineDisplacements) {
+    maxDisp = std::max(maxDisp, d.vectorLength());
+  }
+  for (const auto& d : a_coarDisplacements) {
+    maxDisp = std::max(maxDisp, d.vectorLength());
+  }
+  for (const auto& w : a_fineWeights) {
+    maxWeight = std::max(maxWeight, std::abs(w));
+  }
+  for (const auto& w : a_coarWeights) {
+    maxWeight = std::max(maxWeight, std::abs(w));
+  }
+
+  // Degenerate systems are not cached.
+  if (maxDisp <= 0.0 || maxWeight <= 0.0 || !std::isfinite(maxDisp) || !std::isfinite(maxWeight)) {
+    return key;
+  }
+
+  const Real dispScale   = 1.0 / (maxDisp * s_cacheTolerance);
+  const Real weightScale = 1.0 / (maxWeight * s_cacheTolerance);
+
+  key.reserve(8 + SpaceDim * (a_derivs.numPts() + a_knownTerms.numPts()) +
+              (SpaceDim + 1) * (a_fineDisplacements.size() + a_coarDisplacements.size()));
+
+  key.emplace_back(a_tag);
+  key.emplace_back(a_order);
+  key.emplace_back(a_fineDisplacements.size());
+  key.emplace_back(a_coarDisplacements.size());
+  key.emplace_back(a_derivs.numPts());
+  key.emplace_back(a_knownTerms.numPts());
+  key.emplace_back(std::llround(std::log(maxDisp) / s_cacheTolerance));
+
+  for (IVSIterator ivsIt(a_derivs); ivsIt.ok(); ++ivsIt) {
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      key.emplace_back(ivsIt()[dir]);
+    }
+  }
+  for (IVSIterator ivsIt(a_knownTerms); ivsIt.ok(); ++ivsIt) {
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      key.emplace_back(ivsIt()[dir]);
+    }
+  }
+  for (const auto& d : a_fineDisplacements) {
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      key.emplace_back(std::llround(d[dir] * dispScale));
+    }
+  }
+  for (const auto& d : a_coarDisplacements) {
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      key.emplace_back(std::llround(d[dir] * dispScale));
+    }
+  }
+  for (const auto& w : a_fineWeights) {
+    key.emplace_back(std::llround(w * weightScale));
+  }
+  for (const auto& w : a_coarWeights) {
+    key.emplace_back(std::llround(w * weightScale));
+  }
+
+  return key;
+}
+
+bool
+LeastSquares::getCachedWeights(std::vector<Real>& a_weights, const std::vector<long long>& a_key) noexcept
+{
+  bool found = false;
+
+  if (!a_key.empty()) {
+#pragma omp critical(LeastSquaresCache)
+    {
+      s_cacheLookups++;
+
+      const auto it = s_cache.find(a_key);
+
+      if (it != s_cache.end()) {
+        a_weights = it->second;
+
+        s_cacheHits++;
+
+        found = true;
+      }
+    }
+  }
+
+  return found;
+}
+
+void
+LeastSquares::cacheWeights(const std::vector<long long>& a_key, const std::vector<Real>& a_weights) noexcept
+{
+  if (!a_key.empty()) {
+    const long long entryBytes = LeastSquares::getCacheEntryBytes(a_key, a_weights);
+
+#pragma omp critical(LeastSquaresCache)
+    {
+      // Start over if the new entry would take the cache above the memory limit. Entries that are by themselves larger
+      // than the limit are never cached.
+      if (s_cacheBytes + entryBytes > s_maxCacheBytes) {
+        s_cache.clear();
+
+        s_cacheBytes = 0LL;
+      }
+
+      if (entryBytes <= s_maxCacheBytes && s_cache.emplace(a_key, a_weights).second) {
+        s_cacheBytes += entryBytes;
+      }
+    }
+  }
+}
+
+long long
+LeastSquares::getCacheEntryBytes(const std::vector<long long>& a_key, const std::vector<Real>& a_weights) noexcept
+{
+  // Approximate size of one node in the hash table: the node itself (key, value and the link to the next node), the
+  // heap storage for the key and the weights, and the bucket pointer.
+  constexpr long long nodeBytes = sizeof(std::vector<long long>) + sizeof(std::vector<Real>) + 2 * sizeof(void*);
+
+  return nodeBytes + a_key.capacity() * sizeof(long long) + a_weights.capacity() * sizeof(Real);
+}
+
+void
+LeastSquares::getCacheStatistics(long long& a_hits, long long& a_lookups) noexcept
+{
+#pragma omp critical(LeastSquaresCache)
+  {
+    a_hits    = s_cacheHits;
+    a_lookups = s_cacheLookups;
+  }
+}
+
+void
+LeastSquares::clearCache() noexcept
+{
+#pragma omp critical(LeastSquaresCache)
+  {
+    s_cache.clear();
+
+    s_cacheBytes = 0LL;
+  }
+}
+
 #include <CD_NamespaceFooter.H>
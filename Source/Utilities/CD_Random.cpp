@@ -17,8 +17,11 @@ thread_local std::mt19937_64                      Random::s_rng       = std::mt1
 thread_local std::uniform_real_distribution<Real> Random::s_uniform01 = std::uniform_real_distribution<Real>(0.0, 1.0);
 thread_local std::uniform_real_distribution<Real> Random::s_uniform11 = std::uniform_real_distribution<Real>(-1.0, 1.0);
 thread_local std::normal_distribution<Real>       Random::s_normal01  = std::normal_distribution<Real>(0.0, 1.0);
+thread_local Philox4x32                           Random::s_philox    = Philox4x32(0, 0);
 
-bool Random::s_seeded = false;
+bool Random::s_seeded       = false;
+bool Random::s_counterBased = false;
+int  Random::s_seed         = 0;
 
 //std::once_flag once = std::once_flag();
 